@@ -46,17 +46,31 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
 #include "CANOpenShell.h"
 #include "CANOpenShellMasterOD.h"
 #include "CANOpenShellSlaveOD.h"
+#include "CANOpenShellSDO.h"
+#include "CANOpenShellOS.h"
+#include "CANOpenShellCapture.h"
+#include "CANOpenShellTrace.h"
+#include "CANOpenShellTiming.h"
+#include "CANOpenShellRT.h"
+#include "CANOpenShellODIndex.h"
+#include "CANOpenShellEDS.h"
+#include "CANOpenShellDiscover.h"
+#include "CANOpenShellCache.h"
+#include "CANOpenShellHeartbeat.h"
+#include "CANOpenShellEmcy.h"
+#include "CANOpenShellParam.h"
+#include "CANOpenShellBackup.h"
+#include "CANOpenShellCompare.h"
 
 //****************************************************************************
 // DEFINES
-#define MAX_NODES 127
 #define cst_str4(c1, c2, c3, c4) ((((unsigned int)0 | \
                                     (char)c4 << 8) | \
                                    (char)c3) << 8 | \
                                   (char)c2) << 8 | \
                                  (char)c1
 
-#define WAIT_NS 500000000l
+#define BATCH_WINDOW 64
 #define INIT_ERR 2
 #define QUIT 1
 #define handle_error(msg) \
@@ -69,11 +83,12 @@ s_BOARD Board = {BoardBusName, BoardBaudRate};
 CO_Data* CANOpenShellOD_Data;
 char LibraryPath[512];
 
-sem_t Write_sem;
-struct timespec Write_sem_ts;
-sem_t Read_sem;
-struct timespec Read_sem_ts;
 int CurrentNode=0;
+char BatchFile[256];
+int Batch=0;
+char ODFile[256];
+
+static void PrintRecord(OS_command* cmd);
 
 /* Sleep for n seconds */
 void SleepFunction(int second)
@@ -100,6 +115,7 @@ void StopNode(UNS8 nodeid)
 /* Ask a slave node to reset */
 void ResetNode(UNS8 nodeid)
 {
+	Cache_invalidate(nodeid);
 	masterSendNMTstateChange(CANOpenShellOD_Data, nodeid, NMT_Reset_Node);
 }
 
@@ -110,20 +126,39 @@ void DiscoverNodes()
 	ResetNode(0x00);
 }
 
-int get_info_step = 0;
+/* Value of a finished upload, as the unsigned integer it usually is */
+static UNS32 RequestValue(const SDO_request* req)
+{
+	UNS32 data = 0;
+
+	memcpy(&data, req->data, req->size < sizeof(data) ? req->size : sizeof(data));
+	return data;
+}
+
+/* Queue one request of a shell command, stack mutex held */
+static void EnqueueDeviceRequest(SDO_request* req, SDO_done_t callback, long step)
+{
+	if (!req)
+	{
+		printf("\nResult : Failed in getting information, AbortCode :%4.4x \n", SDOABT_OUT_OF_MEMORY);
+		return;
+	}
+	req->callback = callback;
+	req->user = (void*)step;
+	SDO_enqueue(CANOpenShellOD_Data, req);
+}
+
 /* Callback function that check the read SDO demand */
-void CheckReadInfoSDO(CO_Data* d, UNS8 nodeid)
+void CheckReadInfoSDO(CO_Data* d, SDO_request* req)
 {
-	UNS32 abortCode;
-	UNS32 data=0;
-	UNS32 size=64;
+	UNS32 data = RequestValue(req);
 
-	if(getReadResultNetworkDict(CANOpenShellOD_Data, nodeid, &data, &size, &abortCode) != SDO_FINISHED)
-		printf("Master : Failed in getting information for slave %2.2x, AbortCode :%4.4x \n", nodeid, abortCode);
+	if(req->result != SDO_FINISHED)
+		printf("Master : Failed in getting information for slave %2.2x, AbortCode :%4.4x \n", req->nodeId, req->abortCode);
 	else
 	{
 		/* Display data received */
-		switch(get_info_step)
+		switch((long)req->user)
 		{
 			case 1:
 					printf("Device type     : %x\n", data);
@@ -139,54 +174,36 @@ void CheckReadInfoSDO(CO_Data* d, UNS8 nodeid)
 					break;
 		}
 	}
-	/* Finalize last SDO transfer with this node */
-	closeSDOtransfer(CANOpenShellOD_Data, nodeid, SDO_CLIENT);
-
-	GetSlaveNodeInfo(nodeid);
+	SDO_free(req);
 }
 
-/* Retrieve node informations located at index 0x1000 (Device Type) and 0x1018 (Identity) */
+/* Retrieve node informations located at index 0x1000 (Device Type) and 0x1018 (Identity).
+ * The reads queue up in order on the channel of the node, the cache
+ * answers them when the node was already asked since it booted. */
 void GetSlaveNodeInfo(UNS8 nodeid)
 {
-		switch(++get_info_step)
-		{
-			case 1: /* Get device type */
-				printf("##################################\n");
-				printf("#### Informations for node %x ####\n", nodeid);
-				printf("##################################\n");
-				readNetworkDictCallback(CANOpenShellOD_Data, nodeid, 0x1000, 0x00, 0, CheckReadInfoSDO, 0);
-				break;
-
-			case 2: /* Get Vendor ID */
-				readNetworkDictCallback(CANOpenShellOD_Data, nodeid, 0x1018, 0x01, 0, CheckReadInfoSDO, 0);
-				break;
-
-			case 3: /* Get Product Code */
-				readNetworkDictCallback(CANOpenShellOD_Data, nodeid, 0x1018, 0x02, 0, CheckReadInfoSDO, 0);
-				break;
-
-			case 4: /* Get Revision Number */
-				readNetworkDictCallback(CANOpenShellOD_Data, nodeid, 0x1018, 0x03, 0, CheckReadInfoSDO, 0);
-				break;
-
-			case 5: /* Print node info */
-				get_info_step = 0;
-		}
+	printf("##################################\n");
+	printf("#### Informations for node %x ####\n", nodeid);
+	printf("##################################\n");
+	/* Get device type */
+	EnqueueDeviceRequest(SDO_read_request(nodeid, 0x1000, 0x00, 0, 0), CheckReadInfoSDO, 1);
+	/* Get Vendor ID */
+	EnqueueDeviceRequest(SDO_read_request(nodeid, 0x1018, 0x01, 0, 0), CheckReadInfoSDO, 2);
+	/* Get Product Code */
+	EnqueueDeviceRequest(SDO_read_request(nodeid, 0x1018, 0x02, 0, 0), CheckReadInfoSDO, 3);
+	/* Get Revision Number */
+	EnqueueDeviceRequest(SDO_read_request(nodeid, 0x1018, 0x03, 0, 0), CheckReadInfoSDO, 4);
 }
 /* Callback function that check the read SDO demand */
-void CheckReadSDO(CO_Data* d, UNS8 nodeid)
+void CheckReadSDO(CO_Data* d, SDO_request* req)
 {
-	UNS32 abortCode;
-	UNS32 data=0;
-	UNS32 size=64;
+	UNS32 data = RequestValue(req);
 
-	if(getReadResultNetworkDict(CANOpenShellOD_Data, nodeid, &data, &size, &abortCode) != SDO_FINISHED)
-		printf("\nResult : Failed in getting information for slave %2.2x, AbortCode :%4.4x \n", nodeid, abortCode);
+	if(req->result != SDO_FINISHED)
+		printf("\nResult : Failed in getting information for slave %2.2x, AbortCode :%4.4x \n", req->nodeId, req->abortCode);
 	else
 		printf("\n= 0x%x (%d)\n", data,data);
-
-	/* Finalize last SDO transfer with this node */
-	closeSDOtransfer(CANOpenShellOD_Data, nodeid, SDO_CLIENT);
+	SDO_free(req);
 }
 /* Read a slave node object dictionary entry */
 void ReadDeviceEntry(char* sdo)
@@ -208,7 +225,7 @@ void ReadDeviceEntry(char* sdo)
 		printf("Index    : %4.4x\n", index);
 		printf("SubIndex : %2.2x\n", subindex);
 
-		readNetworkDictCallback(CANOpenShellOD_Data, (UNS8)nodeid, (UNS16)index, (UNS8)subindex, (UNS8)datatype, CheckReadSDO, 0);
+		EnqueueDeviceRequest(SDO_read_request((UNS8)nodeid, (UNS16)index, (UNS8)subindex, (UNS8)datatype, 0), CheckReadSDO, 0);
 	}
 	else
 		printf("Wrong command  : %s\n", sdo);
@@ -217,206 +234,465 @@ void ReadDeviceEntry(char* sdo)
 /* Read a slave node object dictionary entry */
 void ReadSDOEntry(int nodeid, int index, int subindex)
 {
-	int ret=0;
 	int datatype = 0;
 
-		readNetworkDictCallback(CANOpenShellOD_Data, (UNS8)nodeid, (UNS16)index, (UNS8)subindex, (UNS8)datatype, CheckReadSDO, 0);
+		EnqueueDeviceRequest(SDO_read_request((UNS8)nodeid, (UNS16)index, (UNS8)subindex, (UNS8)datatype, 0), CheckReadSDO, 0);
 }
 
 
-UNS8 SDO_read_callback_result;
-UNS32 SDO_read_callback_abortCode;
-char SDO_read_data[256];
-UNS32 SDO_read_data_size;
-/* Callback function that check the read SDO demand */
-void SDO_read_callback(CO_Data* d, UNS8 nodeid)
+/* Callback function that check the write SDO demand */
+void CheckWriteSDO(CO_Data* d, SDO_request* req)
 {
+	if(req->result != SDO_FINISHED)
+		printf("\nResult : Failed in getting information for slave %2.2x, AbortCode :%4.4x \n", req->nodeId, req->abortCode);
+	else
+		printf("\nSend data OK\n");
+	SDO_free(req);
+}
+/* Write a slave node object dictionnary entry, the queue drops any
+ * cached value of the entry */
+void WriteDeviceEntry(char* sdo)
+{
+	int ret=0;
+	int nodeid;
+	int index;
+	int subindex;
+	int size;
+	int data;
 
-	SDO_read_data_size = 255;
-	SDO_read_callback_result = getReadResultNetworkDict(CANOpenShellOD_Data, nodeid, &SDO_read_data, &SDO_read_data_size, &SDO_read_callback_abortCode);
+	ret = sscanf(sdo, "wsdo#%2x,%4x,%2x,%2x,%x", &nodeid , &index, &subindex, &size, &data);
+	if (ret == 5)
+	{
+		printf("##################################\n");
+		printf("#### Write SDO                ####\n");
+		printf("##################################\n");
+		printf("NodeId   : %2.2x\n", nodeid);
+		printf("Index    : %4.4x\n", index);
+		printf("SubIndex : %2.2x\n", subindex);
+		printf("Size     : %2.2x\n", size);
+		printf("Data     : %x\n", data);
 
-	SDO_read_data[SDO_read_data_size] = 0;
-	/* Finalize last SDO transfer with this node */
-	closeSDOtransfer(CANOpenShellOD_Data, nodeid, SDO_CLIENT);
-	sem_post(&Read_sem);
+		EnqueueDeviceRequest(SDO_write_request(nodeid, index, subindex, size, 0, &data, 0), CheckWriteSDO, 0);
+	}
+	else
+		printf("Wrong command  : %s\n", sdo);
 }
 
-/* Read a slave node object dictionary entry */
-UNS8 SDO_read(CO_Data* d, UNS8 nodeId, UNS16 index, UNS8 subIndex, UNS8 dataType, UNS8 useBlockMode)
+
+/* Write a slave node object dictionnary entry */
+void WriteSDOEntry(int nodeid, int index, int subindex, int size, UNS32  data)
 {
-	
-	int ret=0;
-	
-	UNS8 readResult;
-	int s;
+	EnqueueDeviceRequest(SDO_write_request(nodeid, index, subindex, size, 0, &data, 0), CheckWriteSDO, 0);
+}
 
-	SDO_read_callback_result = 44; //set to a random number
+/* Send an interpreter command through the OS command object and print the reply */
+void OSCommand(UNS8 nodeid, char* command)
+{
+	OS_command *cmd = OS_command_new(nodeid, command);
 
+	if (!cmd)
+		return;
+	OS_submit(CANOpenShellOD_Data, cmd);
+	OS_wait(cmd);
 
+	if (cmd->result != SDO_FINISHED)
+		printf("\nResult : Failed in getting information for slave %2.2x, AbortCode :%4.4x \n", nodeid, cmd->abortCode);
+	else if (cmd->status == OS_STATUS_ERROR_REPLY || cmd->status == OS_STATUS_ERROR_NO_REPLY)
+		printf("Error : %s\t[%ld us]\n", cmd->reply, OS_latency_us(cmd));
+	else
+		printf("%s\t[%ld us]\n", cmd->reply, OS_latency_us(cmd));
+	OS_free(cmd);
+}
 
-	readResult = readNetworkDictCallback(CANOpenShellOD_Data, (UNS8)nodeId, (UNS16)index, (UNS8)subIndex, (UNS8)dataType, SDO_read_callback, useBlockMode);
-	LeaveMutex();
-	
-	if (clock_gettime(CLOCK_REALTIME, &Read_sem_ts) == -1)
-		handle_error("clock_gettime");
-	
-	Read_sem_ts.tv_nsec += WAIT_NS; // 100ms
-			
-	if (Read_sem_ts.tv_nsec >= 1000000000l){
-		Read_sem_ts.tv_sec++;
-		Read_sem_ts.tv_nsec -= 1000000000l;
+/* Parse a node list such as "01-05,0a,10-12" (hex) into nodes[].
+ * Returns the number of nodes, or -1 on a syntax error. */
+int ParseNodeList(const char* list, UNS8* nodes)
+{
+	int count = 0;
+	int first;
+	int last;
+	int n;
+	int used;
+
+	while (*list && *list != ' ')
+	{
+		if (sscanf(list, "%x-%x%n", &first, &last, &used) == 2)
+			;
+		else if (sscanf(list, "%x%n", &first, &used) == 1)
+			last = first;
+		else
+			return -1;
+		if (first < 1 || last > MAX_NODES || first > last)
+			return -1;
+		for(n = first ; n <= last && count < MAX_NODES ; n++)
+			nodes[count++] = n;
+		list += used;
+		if (*list == ',')
+			list++;
+		else if (*list && *list != ' ')
+			return -1;
 	}
+	return count;
+}
 
-	while ((s = sem_timedwait(&Read_sem, &Read_sem_ts)) == -1 && errno == EINTR)
-		continue;       /* Restart if interrupted by handler */
+/* Send the same interpreter command to several nodes at once and print
+ * the replies in a table. Syntax: <nodelist> <command> */
+void FanOutCommand(char* args)
+{
+	UNS8 nodes[MAX_NODES];
+	OS_command *cmds[MAX_NODES];
+	char *command = strchr(args, ' ');
+	int count = ParseNodeList(args, nodes);
+	int i;
 
-	/* Check what happened */
+	if (count <= 0 || !command || !*++command)
+	{
+		printf("Wrong command  : %s\n", args);
+		return;
+	}
 
-	if (s == -1) {
-		if (errno == ETIMEDOUT)
-			printf("sem_timedwait() timed out\n");
-		else
-			perror("sem_timedwait");
-	} else
-		if(SDO_read_callback_result != SDO_FINISHED)
-			printf("\nResult : Failed in getting information for slave %2.2x, AbortCode :%4.4x \n", nodeId, SDO_read_callback_abortCode);
-		/*else
-			printf("Result: %s\n",SDO_read_data); */
+	/* Each node runs on its own client SDO channel */
+	for(i = 0 ; i < count ; i++)
+	{
+		cmds[i] = OS_command_new(nodes[i], command);
+		if (cmds[i])
+			OS_submit(CANOpenShellOD_Data, cmds[i]);
+	}
 
-	return readResult;
+	if (!Batch)
+		printf("Node  Status  Abort     Latency(us)  Reply\n");
+	for(i = 0 ; i < count ; i++)
+	{
+		if (!cmds[i])
+			continue;
+		OS_wait(cmds[i]);
+		if (Batch)
+			PrintRecord(cmds[i]);
+		else if (cmds[i]->result != SDO_FINISHED)
+			printf("%2.2x    -       %8.8x  %-11ld  -\n", nodes[i], cmds[i]->abortCode, OS_latency_us(cmds[i]));
+		else
+			printf("%2.2x    %-6d  %8.8x  %-11ld  %s\n", nodes[i], cmds[i]->status, cmds[i]->abortCode,
+					OS_latency_us(cmds[i]), cmds[i]->reply);
+		OS_free(cmds[i]);
+	}
 }
 
-UNS8 SDO_write_callback_result;
-UNS32 SDO_write_callback_abortCode;
-/* Callback function that check the write SDO demand */
-void SDO_write_callback(CO_Data* d, UNS8 nodeid)
+static void PrintIdentity(const Discover_node* node, UNS8 field, UNS32 value)
 {
-	UNS32 abortCode;
-	
-	SDO_write_callback_result = getWriteResultNetworkDict(CANOpenShellOD_Data, nodeid, &SDO_write_callback_abortCode);
-	
-	/* Finalize last SDO transfer with this node */
-	closeSDOtransfer(CANOpenShellOD_Data, nodeid, SDO_CLIENT);
-	sem_post(&Write_sem);
+	if (node->valid & field)
+		printf("%8.8x  ", value);
+	else
+		printf("-         ");
 }
-/* Write a slave node object dictionnary entry */
-UNS8 SDO_write(CO_Data* d, UNS8 nodeId, UNS16 index,
-		       UNS8 subIndex, UNS32 count, UNS8 dataType, void *data, UNS8 useBlockMode)
+
+/* Read the identity of every node at once and print the inventory.
+ * Syntax: disc[#nodelist [timeout_ms]] (all nodes by default) */
+void DiscoverInventory(char* args)
 {
-	int ret=0;
-	
-	UNS8 writeResult;
-	int s;
-
-	SDO_write_callback_result = 44; //set to a random number
-	
-	//-- Write command --//
-	writeResult = writeNetworkDictCallBack(d, nodeId,index, subIndex, count, dataType, data, SDO_write_callback, useBlockMode);
-	LeaveMutex();
-	
-	if (clock_gettime(CLOCK_REALTIME, &Write_sem_ts) == -1)
-		handle_error("clock_gettime");
-	
-	Write_sem_ts.tv_nsec += WAIT_NS; // 100ms
-			
-	if (Write_sem_ts.tv_nsec >= 1000000000l){
-		Write_sem_ts.tv_sec++;
-		Write_sem_ts.tv_nsec -= 1000000000l;
+	UNS8 nodes[MAX_NODES];
+	Discover_node inventory[MAX_NODES];
+	Discover_node *node;
+	char *timeout = strchr(args, ' ');
+	UNS8 self = getNodeId(CANOpenShellOD_Data);
+	UNS64 start = SDO_now();
+	int count = 0;
+	int present;
+	int i;
+
+	if (args[4] == '#')
+		count = ParseNodeList(args + 5, nodes);
+	else
+		for(i = 1 ; i <= MAX_NODES ; i++)
+			nodes[count++] = i;
+	if (count <= 0)
+	{
+		printf("Wrong command  : %s\n", args);
+		return;
+	}
+	/* Not ourselves */
+	for(i = 0 ; i < count ; i++)
+		if (nodes[i] == self)
+			nodes[i--] = nodes[--count];
+
+	present = Discover_scan(CANOpenShellOD_Data, nodes, count,
+			timeout ? atoi(timeout) * 1000 : 0, inventory);
+	if (present < 0)
+	{
+		printf("Discovery failed\n");
+		return;
 	}
 
-	while ((s = sem_timedwait(&Write_sem, &Write_sem_ts)) == -1 && errno == EINTR)
-		continue;       /* Restart if interrupted by handler */
-
-	/* Check what happened */
-
-	if (s == -1) {
-		if (errno == ETIMEDOUT)
-			printf("sem_timedwait() timed out\n");
-		else
-			perror("sem_timedwait");
-	} else
-		if(SDO_write_callback_result != SDO_FINISHED)
-			printf("\nResult : Failed in getting information for slave %2.2x, AbortCode :%4.4x \n", nodeId, SDO_write_callback_abortCode);
+	if (!Batch)
+		printf("Node  DeviceType  Vendor    Product   Revision  Serial    Time(us)\n");
+	for(i = 0 ; i < count ; i++)
+	{
+		node = &inventory[i];
+		if (!node->present)
+			continue;
+		if (Batch)
+		{
+			printf("%2.2x\t%8.8x\t%8.8x\t%8.8x\t%8.8x\t%8.8x\t%8.8x\t%llu\n", node->nodeId,
+					node->deviceType, node->vendor, node->product, node->revision,
+					node->serial, node->abortCode, (unsigned long long)node->elapsed / 1000);
+			continue;
+		}
+		printf("%2.2x    %8.8x    ", node->nodeId, node->deviceType);
+		PrintIdentity(node, DISCOVER_VENDOR, node->vendor);
+		PrintIdentity(node, DISCOVER_PRODUCT, node->product);
+		PrintIdentity(node, DISCOVER_REVISION, node->revision);
+		PrintIdentity(node, DISCOVER_SERIAL, node->serial);
+		printf("%llu\n", (unsigned long long)node->elapsed / 1000);
+	}
+	if (!Batch)
+		printf("%d of %d nodes in %llu ms\n", present, count,
+				(unsigned long long)(SDO_now() - start) / 1000000);
+	fflush(stdout);
+}
 
-	return writeResult;
+/* Write a DCF or CSV parameter set to several nodes at once, reading
+ * every object back if verify. Syntax: <nodelist> <file> */
+void DownloadParameters(char* args, int verify)
+{
+	UNS8 nodes[MAX_NODES];
+	Param_report reports[MAX_NODES];
+	char *path = strchr(args, ' ');
+	int count = ParseNodeList(args, nodes);
+	UNS32 objects = 0;
+	UNS32 failed = 0;
+	long elapsed;
+	int i;
+
+	if (count <= 0 || !path || !*++path)
+	{
+		printf("Wrong command  : %s\n", args);
+		return;
+	}
+	elapsed = Param_download(CANOpenShellOD_Data, path, nodes, count, verify, reports, stdout);
+	if (elapsed < 0)
+		return;
 
+	if (!Batch)
+		printf("Node  Objects  Written  Verified  Failed\n");
+	for(i = 0 ; i < count ; i++)
+	{
+		objects += reports[i].objects;
+		failed += reports[i].failed;
+		printf(Batch ? "%2.2x\t%u\t%u\t%u\t%u\n" : "%2.2x    %-7u  %-7u  %-8u  %u\n", reports[i].nodeId,
+				reports[i].objects, reports[i].written, reports[i].verified, reports[i].failed);
+	}
+	if (!Batch)
+		printf("%u objects to %d nodes in %ld ms (%.0f objects/s), %u failed\n", objects, count,
+				elapsed / 1000, elapsed ? objects * 1e6 / elapsed : 0.0, failed);
+	fflush(stdout);
 }
 
-
-/* Callback function that check the write SDO demand */
-void CheckWriteSDO(CO_Data* d, UNS8 nodeid)
+/* Save the object dictionary of several nodes at once, one DCF per node.
+ * Syntax: <nodelist> <prefix> [eds] */
+void BackupNodes(char* args)
 {
-	UNS32 abortCode;
+	UNS8 nodes[MAX_NODES];
+	Backup_report reports[MAX_NODES];
+	char *prefix = strchr(args, ' ');
+	char *eds;
+	int count = ParseNodeList(args, nodes);
+	UNS32 objects = 0;
+	UNS32 bytes = 0;
+	int saved = 0;
+	long elapsed;
+	int i;
+
+	if (count <= 0 || !prefix || !*++prefix)
+	{
+		printf("Wrong command  : %s\n", args);
+		return;
+	}
+	eds = strchr(prefix, ' ');
+	if (eds)
+		*eds++ = 0;
+	elapsed = Backup_nodes(CANOpenShellOD_Data, nodes, count, prefix, eds, reports, stdout);
+	if (elapsed < 0)
+		return;
+
+	if (!Batch)
+		printf("Node  Objects  Failed  Bytes    Abort     Time(ms)\n");
+	for(i = 0 ; i < count ; i++)
+	{
+		objects += reports[i].objects;
+		bytes += reports[i].bytes;
+		saved += reports[i].saved;
+		printf(Batch ? "%2.2x\t%u\t%u\t%u\t%8.8x\t%llu\n" : "%2.2x    %-7u  %-6u  %-7u  %8.8x  %llu\n",
+				reports[i].nodeId, reports[i].objects, reports[i].failed, reports[i].bytes,
+				reports[i].abortCode, (unsigned long long)reports[i].elapsed / 1000);
+	}
+	if (!Batch)
+		printf("%d of %d nodes saved, %u objects (%u bytes) in %ld ms\n", saved, count,
+				objects, bytes, elapsed / 1000);
+	fflush(stdout);
+}
 
-	if(getWriteResultNetworkDict(CANOpenShellOD_Data, nodeid, &abortCode) != SDO_FINISHED)
-		printf("\nResult : Failed in getting information for slave %2.2x, AbortCode :%4.4x \n", nodeid, abortCode);
-	else
-		printf("\nSend data OK\n");
+/* Compare several nodes with a baseline DCF, printing the objects that
+ * differ. Syntax: <nodelist> <file or prefix> */
+void CompareNodes(char* args)
+{
+	UNS8 nodes[MAX_NODES];
+	Compare_report reports[MAX_NODES];
+	char *path = strchr(args, ' ');
+	int count = ParseNodeList(args, nodes);
+	UNS32 objects = 0;
+	UNS32 different = 0;
+	long elapsed;
+	int i;
+
+	if (count <= 0 || !path || !*++path)
+	{
+		printf("Wrong command  : %s\n", args);
+		return;
+	}
+	elapsed = Compare_nodes(CANOpenShellOD_Data, nodes, count, path, reports, stdout);
+	if (elapsed < 0)
+		return;
 
-	/* Finalize last SDO transfer with this node */
-	closeSDOtransfer(CANOpenShellOD_Data, nodeid, SDO_CLIENT);
+	if (!Batch)
+		printf("Node  Objects  Equal    Different  Failed  Cached  Time(ms)\n");
+	for(i = 0 ; i < count ; i++)
+	{
+		objects += reports[i].objects;
+		different += reports[i].different;
+		printf(Batch ? "%2.2x\t%u\t%u\t%u\t%u\t%u\t%llu\n" : "%2.2x    %-7u  %-7u  %-9u  %-6u  %-6u  %llu\n",
+				reports[i].nodeId, reports[i].objects, reports[i].equal, reports[i].different,
+				reports[i].failed, reports[i].cached, (unsigned long long)reports[i].elapsed / 1000);
+	}
+	if (!Batch)
+		printf("%u objects of %d nodes in %ld ms, %u different\n", objects, count,
+				elapsed / 1000, different);
+	fflush(stdout);
 }
-/* Write a slave node object dictionnary entry */
-void WriteDeviceEntry(char* sdo)
+
+/* Watch the heartbeat of nodes. Syntax: hbt#nodelist timeout_ms
+ * (timeout 0 stops watching them). Stack mutex held. */
+void WatchHeartbeat(char* args)
 {
-	int ret=0;
-	int nodeid;
-	int index;
-	int subindex;
-	int size;
-	int data;
+	UNS8 nodes[MAX_NODES];
+	char *timeout = strchr(args, ' ');
+	int count = ParseNodeList(args, nodes);
+	int i;
 
-	ret = sscanf(sdo, "wsdo#%2x,%4x,%2x,%2x,%x", &nodeid , &index, &subindex, &size, &data);
-	if (ret == 5)
+	if (count <= 0 || !timeout)
 	{
-		printf("##################################\n");
-		printf("#### Write SDO                ####\n");
-		printf("##################################\n");
-		printf("NodeId   : %2.2x\n", nodeid);
-		printf("Index    : %4.4x\n", index);
-		printf("SubIndex : %2.2x\n", subindex);
-		printf("Size     : %2.2x\n", size);
-		printf("Data     : %x\n", data);
+		printf("Wrong command  : %s\n", args);
+		return;
+	}
+	for(i = 0 ; i < count ; i++)
+		Heartbeat_watch(CANOpenShellOD_Data, nodes[i], (UNS32)(atof(timeout) * 1000));
+}
 
-		writeNetworkDictCallBack(CANOpenShellOD_Data, nodeid, index, subindex, size, 0, &data, CheckWriteSDO, 0);
+/* Replay a recorded trace through the stack. Syntax: play#file[,speed] */
+void ReplayTrace(char* args)
+{
+	char path[256];
+	double speed = 1.0;
+	Trace_replay_stats stats;
+
+	if (sscanf(args, "play#%255[^,],%lf", path, &speed) < 1)
+	{
+		printf("Wrong command  : %s\n", args);
+		return;
 	}
-	else
-		printf("Wrong command  : %s\n", sdo);
+	if (Trace_replay(CANOpenShellOD_Data, path, speed, &stats) != 0)
+	{
+		printf("Cannot replay %s\n", path);
+		return;
+	}
+	printf("Replayed %llu frames in %llu us (%.0f frames/s), max lateness %llu us\n",
+			(unsigned long long)stats.frames, (unsigned long long)stats.elapsed / 1000,
+			stats.elapsed ? stats.frames * 1e9 / stats.elapsed : 0.0,
+			(unsigned long long)stats.maxLate / 1000);
 }
 
+/* Print the scheduling of the stack threads and the timer latency */
+void RealTimeStatus(void)
+{
+	RT_latency_stats stats;
 
-/* Write a slave node object dictionnary entry */
-void WriteSDOEntry(int nodeid, int index, int subindex, int size, UNS32  data)
+	RT_print(stdout);
+	if (RT_latency(CANOpenShellOD_Data, RT_LATENCY_SAMPLES, RT_LATENCY_PERIOD_US, &stats) != 0 || !stats.samples)
+	{
+		printf("Timer latency not measured\n");
+		return;
+	}
+	printf("  timer latency over %u alarms of %u us: min %llu avg %llu max %llu us\n",
+			stats.samples, RT_LATENCY_PERIOD_US,
+			(unsigned long long)stats.min / 1000,
+			(unsigned long long)(stats.sum / stats.samples) / 1000,
+			(unsigned long long)stats.max / 1000);
+	if (stats.missed)
+		printf("  %u alarms not armed : timer table full\n", stats.missed);
+}
+
+/* Change the SYNC period and report the rate achieved over a few seconds.
+ * Syntax: syn#period_us[,seconds] (period in hex, seconds decimal) */
+void SyncPeriod(char* args)
 {
-	int ret=0;
+	unsigned int period;
+	int seconds = 1;
+	int ret;
 
-	writeNetworkDictCallBack(CANOpenShellOD_Data, nodeid, index, subindex, size, 0, &data, CheckWriteSDO, 0);
+	if (sscanf(args, "syn#%x,%d", &period, &seconds) < 1 || period == 0)
+	{
+		printf("Wrong command  : %s\n", args);
+		return;
+	}
+	EnterMutex();
+	ret = Timing_sync_period(CANOpenShellOD_Data, period);
+	LeaveMutex();
+	if (ret != 0)
+	{
+		printf("Cannot set the SYNC period, not the SYNC producer (0x1005)\n");
+		return;
+	}
+	sleep(seconds);
+	Timing_print_sync(stdout);
 }
 
 void CANOpenShellOD_post_SlaveBootup(CO_Data* d, UNS8 nodeid)
 {
-	printf("Slave %x boot up\n", nodeid);
+	Cache_invalidate(nodeid);
+	if (!Batch)
+		printf("Slave %x boot up\n", nodeid);
+}
+
+/* A watched node stopped sending heartbeats, or started again */
+void CANOpenShellOD_heartbeatEvent(CO_Data* d, UNS8 nodeid, int alive)
+{
+	if (!alive)
+		Cache_invalidate(nodeid);
+	if (!Batch)
+		printf("Slave %x heartbeat %s\n", nodeid, alive ? "back" : "lost");
 }
 
 /***************************  CALLBACK FUNCTIONS  *****************************************/
 void CANOpenShellOD_initialisation(CO_Data* d)
 {
-	printf("Node_initialisation\n");
+	if (!Batch)
+		printf("Node_initialisation\n");
 }
 
 void CANOpenShellOD_preOperational(CO_Data* d)
 {
-	printf("Node_preOperational\n");
+	if (!Batch)
+		printf("Node_preOperational\n");
 }
 
 void CANOpenShellOD_operational(CO_Data* d)
 {
-	printf("Node_operational\n");
+	if (!Batch)
+		printf("Node_operational\n");
 }
 
 void CANOpenShellOD_stopped(CO_Data* d)
 {
-	printf("Node_stopped\n");
+	if (!Batch)
+		printf("Node_stopped\n");
 }
 
 void CANOpenShellOD_post_sync(CO_Data* d)
@@ -433,11 +709,44 @@ void CANOpenShellOD_post_TPDO(CO_Data* d)
 
 UNS32 OnStatus3Update(CO_Data* d, const indextable * unsused_indextable, UNS8 unsused_bSubindex)
 {
-    printf("Status3: %x\n",Status3);
+    /* Printing from the receive thread drops frames at high SYNC rates,
+     * the capture thread reports the RPDO instead */
+    if (!Capture_running() && !Batch)
+        printf("Status3: %x\n",Status3);
     return 0;
 }
+
+/***************************  RECEIVE PATH  *****************************************/
+/* The shell is linked with -Wl,--wrap=canDispatch,--wrap=canSend: every
+ * frame read by the CAN receive thread and every frame sent by the stack
+ * comes through here, stack mutex held. Keep these paths free of
+ * blocking calls. */
+void __real_canDispatch(CO_Data* d, Message *m);
+void __wrap_canDispatch(CO_Data* d, Message *m)
+{
+	UNS64 now = SDO_now();
+
+	RT_record(RT_THREAD_RECEIVE);
+	Capture_frame(m, now);
+	Trace_frame(d, m, now, 0);
+	Timing_frame(d, m, now);
+	Heartbeat_frame(d, m, now);
+	Emcy_frame(m, now);
+	__real_canDispatch(d, m);
+}
+
+UNS8 __real_canSend(CAN_PORT port, Message *m);
+UNS8 __wrap_canSend(CAN_PORT port, Message *m)
+{
+	UNS64 now = SDO_now();
+
+	Trace_frame(CANOpenShellOD_Data, m, now, TRACE_TX);
+	Timing_frame(CANOpenShellOD_Data, m, now);
+	return __real_canSend(port, m);
+}
 void Init(CO_Data* d, UNS32 id)
 {
+	RT_record(RT_THREAD_TIMER);
 	if(Board.baudrate)
 	{
 		/* Init node state*/
@@ -458,6 +767,28 @@ void Exit(CO_Data* d, UNS32 nodeid)
 	}
 }
 
+/* Object dictionary of odfile#, loaded before the stack sees a frame */
+static int LoadODFile(int NodeID)
+{
+	UNS64 start = SDO_now();
+	int line;
+	int count;
+
+	count = EDS_load(CANOpenShellOD_Data, ODFile, NodeID, &line);
+	if (count < 0)
+	{
+		if (line)
+			fprintf(stderr, "%s:%d: syntax error\n", ODFile, line);
+		else
+			perror(ODFile);
+		return INIT_ERR;
+	}
+	if (!Batch)
+		printf("%d objects loaded from %s in %llu us\n", count, ODFile,
+				(unsigned long long)(SDO_now() - start) / 1000);
+	return 0;
+}
+
 int NodeInit(int NodeID, int NodeType)
 {
 	if(NodeType)
@@ -465,8 +796,10 @@ int NodeInit(int NodeID, int NodeType)
 	else
 		CANOpenShellOD_Data = &CANOpenShellSlaveOD_Data;
 
-	/* Load can library */
-	LoadCanDriver(LibraryPath);
+	/* Load can library, baudrate "none" runs the stack without a bus
+	 * (trace replay) */
+	if(strcmp(Board.baudrate, "none"))
+		LoadCanDriver(LibraryPath);
 
 	/* Define callback functions */
 	CANOpenShellOD_Data->initialisation = CANOpenShellOD_initialisation;
@@ -476,9 +809,19 @@ int NodeInit(int NodeID, int NodeType)
 	CANOpenShellOD_Data->post_sync = CANOpenShellOD_post_sync;
 	CANOpenShellOD_Data->post_TPDO = CANOpenShellOD_post_TPDO;
 	CANOpenShellOD_Data->post_SlaveBootup=CANOpenShellOD_post_SlaveBootup;
+	CANOpenShellOD_Data->post_SlaveStateChange=Cache_post_SlaveStateChange;
+	CANOpenShellOD_Data->heartbeatError=Cache_heartbeatError;
+	Heartbeat_on_event(CANOpenShellOD_heartbeatEvent);
+
+	if(ODFile[0] && LoadODFile(NodeID)) return INIT_ERR;
+
+	/* Table lookup instead of the generated scanIndexOD switch (a loaded
+	 * dictionary is already indexed), before the receive thread runs */
+	if(!ODFile[0])
+		ODIndex_install(CANOpenShellOD_Data);
 
 	/* Open the Peak CANOpen device */
-	if(!canOpen(&Board,CANOpenShellOD_Data)) return INIT_ERR;
+	if(strcmp(Board.baudrate, "none") && !canOpen(&Board,CANOpenShellOD_Data)) return INIT_ERR;
 
 	/* Defining the node Id */
 	setNodeId(CANOpenShellOD_Data, NodeID);
@@ -489,18 +832,54 @@ int NodeInit(int NodeID, int NodeType)
 
 void help_menu(void)
 {
+	if (Batch)
+		return;
 	printf("Non-prefixed commands are passed via SDO OS interface on the bus.\n");
 	printf("\n");
 	printf(".node <nodeid> : Set the node to which unprefixed commands are sent.\n");
+	printf(".cmd <nodeid>,<command> : Send one command to another node.\n");
+	printf(".fan#<nodelist> <command> : Send one command to several nodes at once.\n");
+	printf("        ex : .fan#01-14,20 KP[1]\n");
+	printf(".blk#mode : Read OS replies with block transfer (0:never, 1:always, 2:long replies)\n");
+	printf("   Replies are followed by the command latency in microseconds.\n");
 	printf("   Setup COMMAND (must be on the process invocation):\n");
 	printf("     load#CanLibraryPath,channel,baudrate,nodeid,type (0:slave, 1:master)\n");
+	printf("        ex : load#./libcanfestival_can_shellsim.so,0:01-14,1M,0,1 (simulated nodes 1 to 0x14)\n");
+	printf("     rt#priority[,cpu[,lock]] : Run the timer and CAN receive threads SCHED_FIFO\n");
+	printf("        at priority (decimal, 0 to keep), on cpu (-1 for any), lock memory if lock is 1\n");
+	printf("     odfile#file.eds : Build the object dictionary from an EDS or DCF file\n");
+	printf("     batch#file : Run the commands of file (- for stdin) and exit.\n");
+	printf("        One tab-separated record per OS command:\n");
+	printf("        node, command, status, abort code, latency (us), reply\n");
 	printf("\n");
 	printf("   NETWORK: (if nodeid=0x00 : broadcast)\n");
 	printf("     .ssta#nodeid : Start a node\n");
 	printf("     .ssto#nodeid : Stop a node\n");
 	printf("     .srst#nodeid : Reset a node\n");
 	printf("     .scan : Reset all nodes and print message when bootup\n");
+	printf("     .disc[#nodelist [timeout_ms]] : Read the identity of all nodes in parallel\n");
+	printf("     .par#nodelist file : Write a DCF or CSV (index,subindex,size,data) parameter set\n");
+	printf("     .parv#nodelist file : Same, then read every object back to verify it\n");
+	printf("        ex : .parv#01-1e axis.dcf\n");
+	printf("     .bak#nodelist prefix [eds] : Save the objects of each node to <prefix><nodeid>.dcf\n");
+	printf("        ex : .bak#01-1e backup/node axis.eds\n");
+	printf("     .cmp#nodelist file|prefix : Print the objects that differ from a DCF (or <prefix><nodeid>.dcf)\n");
+	printf("        ex : .cmp#01-1e backup/node\n");
+	printf("     .hbt#nodelist timeout_ms : Report nodes silent for timeout_ms (0 to stop watching)\n");
+	printf("     .hbt0 : Stop watching heartbeats\n");
+	printf("     .hbtp : Print the state and heartbeat age of every node heard\n");
+	printf("     .emcy : EMCY count, last code and recent rate of every node\n");
+	printf("     .emc#nodeid : EMCY counters per code and last EMCY of a node\n");
+	printf("     .emx#file : Write EMCY history and counters as tab-separated lines\n");
+	printf("     .emc0 : Forget all EMCY\n");
+	printf("     .cac1 / .cac0 : Read static objects from the SDO cache (default) / from the bus\n");
+	printf("     .cacp : Print SDO cache hits, misses and entries\n");
 	printf("     .wait#seconds : Sleep for n seconds\n");
+	printf("     .rtst : Print the scheduling of the stack threads and measure timer latency\n");
+	printf("     .syn0 / .syn1 : Stop / start SYNC\n");
+	printf("     .syn#period[,seconds] : Set the SYNC period in us (0x1006), start SYNC and report\n");
+	printf("        the achieved rate and missed cycles after seconds (decimal, default 1)\n");
+	printf("        ex : .syn#3e8 (1 ms)\n");
 	printf("\n");
 	printf("   SDO: (size in bytes)\n");
 	printf("     .info#nodeid\n");
@@ -509,6 +888,19 @@ void help_menu(void)
 	printf("     .wsdo#nodeid,index,subindex,size,data : write sdo\n");
 	printf("        ex : .wsdo#42,6200,01,01,FF\n");
 	printf("\n");
+	printf("   CAPTURE:\n");
+	printf("     .cap#file : Record every received RPDO with its timestamp (- for stdout)\n");
+	printf("     .cap0 : Stop recording\n");
+	printf("     .rec#file : Record every frame received and sent into a binary trace\n");
+	printf("     .rec0 : Stop the trace\n");
+	printf("     .play#file[,speed] : Feed the received frames of a trace to the stack\n");
+	printf("        speed 1 : real time, 0 : as fast as possible (decimal)\n");
+	printf("        Use baudrate none in load# to replay without a CAN driver\n");
+	printf("     .tim1 : Start timing SYNC periods and RPDO delays after SYNC\n");
+	printf("     .tim0 : Stop timing\n");
+	printf("     .timp : Print SYNC period error and RPDO delay per node\n");
+	printf("     .tim#file : Write the timing histograms to file\n");
+	printf("\n");
 	printf("   Note: All numbers are hex\n");
 	printf("\n");
 	printf("     .clear: Clear the display\n");
@@ -532,6 +924,9 @@ int ProcessCommand(char* command)
 	int NodeType;
 	UNS32 data = 0;
 	char buf[50];
+	UNS32 abortCode;
+	UNS32 captured;
+	UNS32 dropped;
 
 	EnterMutex();
 	switch(cst_str4(command[0], command[1], command[2], command[3]))
@@ -563,17 +958,69 @@ int ProcessCommand(char* command)
 		case cst_str4('n', 'o', 'd', 'e') : /* Write device entry */
 					ret = sscanf(command, "node %2x", &NodeID);
 					data = 0;
-					SDO_write(CANOpenShellOD_Data,NodeID,0x1024,0x00,1, 0, &data, 0);
+					LeaveMutex();
+					if (SDO_write(CANOpenShellOD_Data,NodeID,0x1024,0x00,1, 0, &data, 0, &abortCode) != SDO_FINISHED)
+						printf("\nResult : Failed in getting information for slave %2.2x, AbortCode :%4.4x \n", NodeID, abortCode);
 					CurrentNode = NodeID;
-					break;
+					return 0;
 		case cst_str4('c', 'm', 'd', ' ') : /* Write device entry */
 
-					ret = sscanf(command, "cmd %2x,%s", &NodeID, buf );
-					SDO_write(CANOpenShellOD_Data,NodeID,0x1023,0x01,strlen(buf),visible_string, buf, 0);
-					SDO_read(CANOpenShellOD_Data,NodeID,0x1023,0x03,visible_string,0);
-					
+					ret = sscanf(command, "cmd %2x,%49s", &NodeID, buf );
+					LeaveMutex();
+					if (ret == 2)
+						OSCommand(NodeID, buf);
 					return 0;
+
+		case cst_str4('b', 'l', 'k', '#') : /* OS reply transfer mode */
+					ret = sscanf(command, "blk#%d", &OS_block_mode);
 					break;
+		case cst_str4('c', 'a', 'p', '#') : /* Capture RPDOs to a file */
+					if (Capture_start(CANOpenShellOD_Data, command + 4) != 0)
+						printf("Capture not started : %s\n", command + 4);
+					break;
+		case cst_str4('c', 'a', 'p', '0') : /* Stop capture */
+					LeaveMutex();
+					Capture_stop();
+					Capture_stats(&captured, &dropped);
+					printf("Captured %u RPDO, dropped %u\n", captured, dropped);
+					return 0;
+		case cst_str4('r', 'e', 'c', '#') : /* Record all frames to a file */
+					LeaveMutex();
+					if (Trace_start(command + 4) != 0)
+						perror(command + 4);
+					return 0;
+		case cst_str4('r', 'e', 'c', '0') : /* Stop recording */
+					printf("Recorded %llu frames\n", (unsigned long long)Trace_count());
+					LeaveMutex();
+					Trace_stop();
+					return 0;
+		case cst_str4('p', 'l', 'a', 'y') : /* Replay a trace */
+					LeaveMutex();
+					ReplayTrace(command);
+					return 0;
+		case cst_str4('t', 'i', 'm', '1') : /* Start SYNC/RPDO timing */
+					Timing_start(CANOpenShellOD_Data);
+					break;
+		case cst_str4('t', 'i', 'm', '0') : /* Stop SYNC/RPDO timing */
+					Timing_stop();
+					break;
+		case cst_str4('t', 'i', 'm', 'p') : /* Print SYNC/RPDO timing */
+					LeaveMutex();
+					Timing_print(stdout);
+					return 0;
+		case cst_str4('t', 'i', 'm', '#') : /* Export SYNC/RPDO timing histograms */
+					LeaveMutex();
+					if (Timing_export(command + 4) != 0)
+						perror(command + 4);
+					return 0;
+		case cst_str4('r', 't', 's', 't') : /* Scheduling of the stack threads */
+					LeaveMutex();
+					RealTimeStatus();
+					return 0;
+		case cst_str4('f', 'a', 'n', '#') : /* OS command to several nodes */
+					LeaveMutex();
+					FanOutCommand(command + 4);
+					return 0;
 
 		case cst_str4('s', 'y', 'n', '0') : /* Display master node state */
                     stopSYNC(CANOpenShellOD_Data);
@@ -581,10 +1028,71 @@ int ProcessCommand(char* command)
 		case cst_str4('s', 'y', 'n', '1') : /* Display master node state */
                     startSYNC(CANOpenShellOD_Data);
                     break;
+		case cst_str4('s', 'y', 'n', '#') : /* Change the SYNC period */
+					LeaveMutex();
+					SyncPeriod(command);
+					return 0;
 		case cst_str4('s', 't', 'a', 't') : /* Display master node state */
                     printf("Status3: %x\n",Status3);
                     Status3 = 0;
                     break;
+		case cst_str4('p', 'a', 'r', '#') : /* Download a parameter set */
+					LeaveMutex();
+					DownloadParameters(command + 4, 0);
+					return 0;
+		case cst_str4('p', 'a', 'r', 'v') : /* Download and read back a parameter set */
+					LeaveMutex();
+					if (command[4] == '#')
+						DownloadParameters(command + 5, 1);
+					else
+						printf("Wrong command  : %s\n", command);
+					return 0;
+		case cst_str4('b', 'a', 'k', '#') : /* Save object dictionaries */
+					LeaveMutex();
+					BackupNodes(command + 4);
+					return 0;
+		case cst_str4('c', 'm', 'p', '#') : /* Compare with a baseline */
+					LeaveMutex();
+					CompareNodes(command + 4);
+					return 0;
+		case cst_str4('h', 'b', 't', '#') : /* Watch heartbeats */
+					WatchHeartbeat(command + 4);
+					break;
+		case cst_str4('h', 'b', 't', '0') : /* Stop watching heartbeats */
+					Heartbeat_stop(CANOpenShellOD_Data);
+					break;
+		case cst_str4('h', 'b', 't', 'p') : /* Heartbeat table */
+					Heartbeat_print(stdout);
+					break;
+		case cst_str4('e', 'm', 'c', 'y') : /* EMCY summary */
+					LeaveMutex();
+					Emcy_print(stdout, 0);
+					return 0;
+		case cst_str4('e', 'm', 'c', '#') : /* EMCY history of a node */
+					LeaveMutex();
+					Emcy_print(stdout, ExtractNodeId(command + 4));
+					return 0;
+		case cst_str4('e', 'm', 'x', '#') : /* Export EMCY history and counters */
+					LeaveMutex();
+					if (Emcy_export(command + 4) != 0)
+						perror(command + 4);
+					return 0;
+		case cst_str4('e', 'm', 'c', '0') : /* Forget EMCY */
+					Emcy_clear();
+					break;
+		case cst_str4('c', 'a', 'c', '1') : /* Read static objects from the SDO cache */
+					Cache_bypass = 0;
+					break;
+		case cst_str4('c', 'a', 'c', '0') : /* Read everything from the bus */
+					Cache_bypass = 1;
+					break;
+		case cst_str4('c', 'a', 'c', 'p') : /* SDO cache statistics */
+					Cache_print(stdout);
+					break;
+		case cst_str4('d', 'i', 's', 'c') : /* Identity of all nodes */
+					LeaveMutex();
+					DiscoverInventory(command);
+					return 0;
 		case cst_str4('s', 'c', 'a', 'n') : /* Display master node state */
 					DiscoverNodes();
 					break;
@@ -709,6 +1217,140 @@ rl_gets ()
 }
 
 
+/* Print a batch record field, escaping the separators */
+static void PrintField(const char* field)
+{
+	for(; *field ; field++)
+	{
+		switch(*field)
+		{
+			case '\t': fputs("\\t", stdout); break;
+			case '\n': fputs("\\n", stdout); break;
+			case '\r': fputs("\\r", stdout); break;
+			case '\\': fputs("\\\\", stdout); break;
+			default: putchar(*field);
+		}
+	}
+}
+
+static void PrintRecord(OS_command* cmd)
+{
+	printf("%2.2x\t", cmd->nodeId);
+	PrintField(cmd->command);
+	if (cmd->result == SDO_FINISHED)
+		printf("\t%d", cmd->status);
+	else
+		printf("\t-");
+	printf("\t%8.8x\t%ld\t", cmd->abortCode, OS_latency_us(cmd));
+	PrintField(cmd->reply);
+	putchar('\n');
+	fflush(stdout);
+}
+
+/* Record of a line that could not be sent */
+static void PrintFailedRecord(UNS8 nodeId, const char* command, UNS32 abortCode)
+{
+	printf("%2.2x\t", nodeId);
+	PrintField(command);
+	printf("\t-\t%8.8x\t0\t\n", abortCode);
+	fflush(stdout);
+}
+
+/* Run every line of a command file without the interactive loop. OS
+ * commands are kept in flight up to BATCH_WINDOW at a time and their
+ * records are printed in submission order as soon as they complete;
+ * prefixed commands wait for all pending OS commands first. */
+int RunBatch(const char* path)
+{
+	FILE *in = strcmp(path, "-") ? fopen(path, "r") : stdin;
+	OS_command *window[BATCH_WINDOW];
+	int first = 0;
+	int count = 0;
+	int ret = 0;
+	char line[SDO_DATA_SIZE];
+	char *end;
+
+	if (!in)
+	{
+		perror(path);
+		return INIT_ERR;
+	}
+
+	printf("#node\tcommand\tstatus\tabort\tlatency_us\treply\n");
+	while (ret != QUIT)
+	{
+		if (count && (count == BATCH_WINDOW || window[first]->done || feof(in)))
+		{
+			/* Stream completed records, blocking only on a full window */
+			OS_wait(window[first]);
+			PrintRecord(window[first]);
+			OS_free(window[first]);
+			first = (first + 1) % BATCH_WINDOW;
+			count--;
+			continue;
+		}
+		if (feof(in) || !fgets(line, sizeof(line), in))
+		{
+			if (!count)
+				break;
+			continue;
+		}
+
+		if ((end = strpbrk(line, "\r\n")))
+			*end = 0;
+		if (line[0] == 0 || line[0] == '#')
+			continue;
+
+		if (line[0] == '.' || line[0] == ',')
+		{
+			while (count)
+			{
+				OS_wait(window[first]);
+				PrintRecord(window[first]);
+				OS_free(window[first]);
+				first = (first + 1) % BATCH_WINDOW;
+				count--;
+			}
+			if (line[0] == '.')
+				ret = ProcessCommand(line + 1);
+			else
+				ret = ProcessFocusedCommand(line + 1);
+			fflush(stdout);
+			continue;
+		}
+
+		window[(first + count) % BATCH_WINDOW] = OS_command_new(CurrentNode, line);
+		if (!window[(first + count) % BATCH_WINDOW])
+		{
+			/* Still one record per line, in order */
+			while (count)
+			{
+				OS_wait(window[first]);
+				PrintRecord(window[first]);
+				OS_free(window[first]);
+				first = (first + 1) % BATCH_WINDOW;
+				count--;
+			}
+			PrintFailedRecord(CurrentNode, line, SDOABT_OUT_OF_MEMORY);
+			continue;
+		}
+		OS_submit(CANOpenShellOD_Data, window[(first + count) % BATCH_WINDOW]);
+		count++;
+	}
+
+	while (count)
+	{
+		OS_wait(window[first]);
+		PrintRecord(window[first]);
+		OS_free(window[first]);
+		first = (first + 1) % BATCH_WINDOW;
+		count--;
+	}
+	if (in != stdin)
+		fclose(in);
+	return ret;
+}
+
 /****************************************************************************/
 /***************************  MAIN  *****************************************/
 /****************************************************************************/
@@ -721,28 +1363,58 @@ int main(int argc, char** argv)
 	int ret=0;
 	int sysret=0;
 	int i=0;
+	int prio;
+	int cpu;
+	int lock;
 
-	if (sem_init(&Write_sem, 0, 0) == -1)
-        handle_error("Writesem_init");
-	if (sem_init(&Read_sem, 0, 0) == -1)
-        handle_error("Readsem_init");	
+	if (SDO_init() == -1)
+		handle_error("SDO_init");
 	/* Defaults */
 	strcpy(LibraryPath,"/usr/lib/libcanfestival_can_peak_linux.so");
 	strcpy(BoardBusName,"0");
 	strcpy(BoardBaudRate,"1M");
 
+	for(i=1 ; i<argc ; i++)
+	{
+		if(strncmp(argv[i], "batch#", 6) == 0)
+		{
+			strncpy(BatchFile, argv[i] + 6, sizeof(BatchFile) - 1);
+			Batch = 1;
+		}
+		else if(strncmp(argv[i], "odfile#", 7) == 0)
+			strncpy(ODFile, argv[i] + 7, sizeof(ODFile) - 1);
+		else if(strncmp(argv[i], "rt#", 3) == 0)
+		{
+			/* Before any stack thread exists, so that they inherit it */
+			prio = 0;
+			cpu = -1;
+			lock = 0;
+			if (sscanf(argv[i], "rt#%d,%d,%d", &prio, &cpu, &lock) < 1 ||
+					RT_setup(prio, cpu, lock) != 0)
+				perror(argv[i]);
+		}
+	}
+
 	/* Init stack timer */
 	TimerInit();
-        
+
 	if (argc > 1){
-        printf("ok\n");
+		if (!Batch)
+			printf("ok\n");
 		/* Strip command-line*/
 		for(i=1 ; i<argc ; i++)
 		{
+			if(strncmp(argv[i], "batch#", 6) == 0 || strncmp(argv[i], "rt#", 3) == 0 ||
+					strncmp(argv[i], "odfile#", 7) == 0)
+				continue;
 			if(ProcessCommand(argv[i]) == INIT_ERR) goto init_fail;
 		}
 	}
-    NodeInit(0,1);
+	/* Default board unless load# already initialised the node */
+	if (!CANOpenShellOD_Data)
+		NodeInit(0,1);
+	/* Only the stack threads run real time */
+	RT_restore();
 
     RegisterSetODentryCallBack(CANOpenShellOD_Data, 0x2003, 0, &OnStatus3Update);
 
@@ -753,12 +1425,20 @@ int main(int argc, char** argv)
     //setState(CANOpenShellOD_Data, Operational);     // Put the master in operational mode
     stopSYNC(CANOpenShellOD_Data);
 
+	if (Batch)
+	{
+		RunBatch(BatchFile);
+		ret = QUIT;
+	}
+
 	/* Enter in a loop to read stdin command until "quit" is called */
 	while(ret != QUIT)
 	{
 		// wait on stdin for string command
 		rl_on_new_line ();
 		res = rl_gets();
+		if (!res)
+			break;
 		//sysret = system(CLEARSCREEN);
 		if(res[0]=='.'){
 		ret = ProcessCommand(res+1);
@@ -770,26 +1450,20 @@ int main(int argc, char** argv)
 
         }
 		else {
-			
-			EnterMutex();
-			SDO_write(CANOpenShellOD_Data,CurrentNode,0x1023,0x01,strlen(res),visible_string, res, 0);
-
-			EnterMutex();
-			SDO_read(CANOpenShellOD_Data,CurrentNode,0x1023,0x03,visible_string,0);
-			
-			printf("%s\n",SDO_read_data);
+			OSCommand(CurrentNode, res);
 		}
 		fflush(stdout);
-        usleep(500000);
 	}
 
-	printf("Finishing.\n");
+	if (!Batch)
+		printf("Finishing.\n");
 
 	// Stop timer thread
 	StopTimerLoop(&Exit);
 
 	/* Close CAN board */
-	canClose(CANOpenShellOD_Data);
+	if(strcmp(Board.baudrate, "none"))
+		canClose(CANOpenShellOD_Data);
 
 init_fail:
 	TimerCleanup();
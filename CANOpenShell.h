@@ -26,16 +26,29 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
 #endif
 
 #include "canfestival.h"
+#include "CANOpenShellSDO.h"
 
 void help(void);
 void StartNode(UNS8);
 void StopNode(UNS8);
 void ResetNode(UNS8);
 void DiscoverNodes(void);
-void CheckReadInfoSDO(CO_Data*, UNS8);
+void CheckReadInfoSDO(CO_Data*, SDO_request*);
 void GetSlaveNodeInfo(UNS8);
-void CheckReadSDO(CO_Data*, UNS8);
-void CheckWriteSDO(CO_Data*, UNS8);
+void CheckReadSDO(CO_Data*, SDO_request*);
+void CheckWriteSDO(CO_Data*, SDO_request*);
 void ReadDeviceEntry(char*);
 void WriteDeviceEntry(char*);
 void SleepFunction(int);
+void OSCommand(UNS8, char*);
+int RunBatch(const char*);
+int ParseNodeList(const char*, UNS8*);
+void FanOutCommand(char*);
+void DiscoverInventory(char*);
+void WatchHeartbeat(char*);
+void DownloadParameters(char*, int);
+void BackupNodes(char*);
+void CompareNodes(char*);
+void ReplayTrace(char*);
+void SyncPeriod(char*);
+void RealTimeStatus(void);
@@ -0,0 +1,470 @@
+/*
+This file is part of CanFestival, a library implementing CanOpen Stack.
+
+Copyright (C): Edouard TISSERANT and Francis DUPIN
+
+See COPYING file for copyrights details.
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+
+
+#include <ctype.h>
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "CANOpenShellBackup.h"
+#include "CANOpenShellEDS.h"
+
+/* Probed without EDS. In a dense range the first missing index ends the
+ * range (SDO and PDO parameters are numbered from the first one). */
+static const struct {
+	UNS16 first;
+	UNS16 last;
+	UNS8 dense;
+} Backup_ranges[] = {
+	{0x1000, 0x1029, 0},	/* communication profile */
+	{0x1200, 0x127F, 1},	/* server SDO parameters */
+	{0x1280, 0x12FF, 1},	/* client SDO parameters */
+	{0x1400, 0x15FF, 1},	/* RPDO communication */
+	{0x1600, 0x17FF, 1},	/* RPDO mapping */
+	{0x1800, 0x19FF, 1},	/* TPDO communication */
+	{0x1A00, 0x1BFF, 1},	/* TPDO mapping */
+	{0x2000, 0x20FF, 0},	/* manufacturer specific */
+	{0x6000, 0x60FF, 0},	/* device profile */
+};
+#define BACKUP_RANGES (sizeof(Backup_ranges) / sizeof(Backup_ranges[0]))
+
+typedef struct {
+	UNS16 index;
+	UNS8 subIndex;
+	UNS8 dataType;
+	UNS8 access;
+	UNS32 size;
+	char *data;
+} Backup_object;
+
+/* Backup of one node, driven from the SDO callbacks: each answer queues
+ * the next read on the channel of the node at once, in stack context. */
+typedef struct {
+	Backup_report *report;
+	const EDS_object *list;	/* objects of the EDS, NULL when probing */
+	int n;
+	int position;		/* in list, or in Backup_ranges */
+	UNS16 index;		/* probed index */
+	UNS8 subCount;		/* subindex 0 of the probed index */
+	SDO_request *req;
+	Backup_object *objects;
+	int count;
+	int capacity;
+	UNS64 start;
+	int *pending;
+} Backup_job;
+
+static pthread_mutex_t Backup_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t Backup_cond = PTHREAD_COND_INITIALIZER;
+
+/* Identity, status and command objects, and the server SDO parameters
+ * the restore itself runs on: not parameters to restore */
+static int Backup_readonly(UNS16 index)
+{
+	if (index >= 0x1200 && index <= 0x127F)
+		return 1;
+	switch(index)
+	{
+		case 0x1000: case 0x1001: case 0x1002: case 0x1003:
+		case 0x1008: case 0x1009: case 0x100A:
+		case 0x1010: case 0x1011: case 0x1018:
+			return 1;
+	}
+	return 0;
+}
+
+static int Backup_printable(const char* data, UNS32 size)
+{
+	UNS32 i;
+
+	for(i = 0 ; i < size ; i++)
+		if (!isprint((unsigned char)data[i]))
+			return 0;
+	return 1;
+}
+
+/* Type of a probed value, from its size */
+static UNS8 Backup_type(const char* data, UNS32 size)
+{
+	switch(size)
+	{
+		case 1: return uint8;
+		case 2: return uint16;
+		case 3: return uint24;
+		case 4: return uint32;
+		case 8: return uint64;
+	}
+	return Backup_printable(data, size) ? visible_string : domain;
+}
+
+static void Backup_finish(Backup_job* job, UNS32 abortCode)
+{
+	if (abortCode && !job->report->abortCode)
+		job->report->abortCode = abortCode;
+	job->report->present = job->count > 0;
+	job->report->elapsed = (SDO_now() - job->start) / 1000;
+	pthread_mutex_lock(&Backup_lock);
+	--*job->pending;
+	pthread_cond_broadcast(&Backup_cond);
+	pthread_mutex_unlock(&Backup_lock);
+}
+
+static int Backup_store(Backup_job* job, const SDO_request* req, UNS8 dataType, UNS8 access)
+{
+	Backup_object *o;
+
+	if (job->count == job->capacity)
+	{
+		o = realloc(job->objects, (job->capacity * 2 + 64) * sizeof(Backup_object));
+		if (!o)
+			return -1;
+		job->objects = o;
+		job->capacity = job->capacity * 2 + 64;
+	}
+	o = &job->objects[job->count];
+	o->data = malloc(req->size + 1);
+	if (!o->data)
+		return -1;
+	memcpy(o->data, req->data, req->size + 1);
+	o->index = req->index;
+	o->subIndex = req->subIndex;
+	o->size = req->size;
+	o->access = access;
+	if (!dataType)
+		dataType = Backup_type(req->data, req->size);
+	else if (dataType == visible_string && !Backup_printable(req->data, req->size))
+		dataType = domain;
+	o->dataType = dataType;
+	job->count++;
+	job->report->objects++;
+	job->report->bytes += req->size;
+	return 0;
+}
+
+static void Backup_read(CO_Data* d, Backup_job* job, UNS16 index, UNS8 subIndex, UNS8 dataType, UNS8 useBlockMode)
+{
+	SDO_request_read(job->req, index, subIndex, dataType, useBlockMode);
+	SDO_enqueue(d, job->req);
+}
+
+/* Next object of the EDS, or done */
+static void Backup_next_listed(CO_Data* d, Backup_job* job)
+{
+	const EDS_object *o;
+
+	while (job->position < job->n && job->list[job->position].access == WO)
+		job->position++;
+	if (job->position == job->n)
+	{
+		Backup_finish(job, 0);
+		return;
+	}
+	o = &job->list[job->position];
+	Backup_read(d, job, o->index, o->subIndex, o->dataType,
+			o->dataType == visible_string || o->dataType == octet_string ||
+			o->dataType == unicode_string || o->dataType == domain);
+}
+
+/* Subindex 0 of the next index to probe, or done */
+static void Backup_next_index(CO_Data* d, Backup_job* job, int rangeEnd)
+{
+	if (rangeEnd || job->index == Backup_ranges[job->position].last)
+	{
+		if (++job->position == BACKUP_RANGES)
+		{
+			Backup_finish(job, 0);
+			return;
+		}
+		job->index = Backup_ranges[job->position].first;
+	}
+	else
+		job->index++;
+	job->subCount = 0;
+	Backup_read(d, job, job->index, 0, 0, 0);
+}
+
+static void Backup_listed(CO_Data* d, Backup_job* job, SDO_request* req)
+{
+	const EDS_object *o = &job->list[job->position];
+
+	if (req->result == SDO_FINISHED)
+	{
+		if (Backup_store(job, req, o->dataType, o->access))
+		{
+			Backup_finish(job, SDOABT_OUT_OF_MEMORY);
+			return;
+		}
+	}
+	else if (req->result == SDO_ABORTED_RCV && req->useBlockMode)
+	{
+		/* Node without block transfer: again segmented */
+		Backup_read(d, job, o->index, o->subIndex, o->dataType, 0);
+		return;
+	}
+	else
+	{
+		job->report->failed++;
+		if (!job->report->abortCode)
+			job->report->abortCode = req->abortCode;
+	}
+	job->position++;
+	Backup_next_listed(d, job);
+}
+
+static void Backup_probed(CO_Data* d, Backup_job* job, SDO_request* req)
+{
+	UNS8 subIndex = req->subIndex;
+
+	if (req->result == SDO_FINISHED)
+	{
+		if (Backup_store(job, req, 0, Backup_readonly(req->index) ? RO : RW))
+		{
+			Backup_finish(job, SDOABT_OUT_OF_MEMORY);
+			return;
+		}
+		if (subIndex == 0 && req->size == 1 && (UNS8)req->data[0])
+			job->subCount = req->data[0];	/* ARRAY or RECORD */
+	}
+	else if (subIndex == 0)
+	{
+		Backup_next_index(d, job, req->abortCode == OD_NO_SUCH_OBJECT &&
+				Backup_ranges[job->position].dense);
+		return;
+	}
+	else if (subIndex == 1 && req->abortCode == OD_NO_SUCH_SUBINDEX)
+		job->subCount = 0;	/* a VAR of one byte */
+
+	if (subIndex < job->subCount)
+		Backup_read(d, job, job->index, subIndex + 1, 0, 0);
+	else
+		Backup_next_index(d, job, 0);
+}
+
+/* Completion of the read of a job, stack mutex held */
+static void Backup_callback(CO_Data* d, SDO_request* req)
+{
+	Backup_job *job = req->user;
+
+	if (req->result == SDO_ABORTED_INTERNAL)
+	{
+		/* No answer: absent, or gone since */
+		Backup_finish(job, req->abortCode);
+		return;
+	}
+	if (job->list)
+		Backup_listed(d, job, req);
+	else
+		Backup_probed(d, job, req);
+}
+
+static void Backup_value(FILE* f, const Backup_object* o)
+{
+	UNS64 value = 0;
+	REAL32 f32;
+	REAL64 f64;
+	UNS32 i;
+
+	switch(o->dataType)
+	{
+		case visible_string:
+			fprintf(f, "%s", o->data);
+			return;
+		case real32:
+			if (o->size == sizeof(float))
+			{
+				memcpy(&f32, o->data, sizeof(float));
+				fprintf(f, "%.9g", f32);
+				return;
+			}
+			break;
+		case real64:
+			if (o->size == sizeof(double))
+			{
+				memcpy(&f64, o->data, sizeof(double));
+				fprintf(f, "%.17g", f64);
+				return;
+			}
+			break;
+	}
+	if (o->dataType != octet_string && o->dataType != unicode_string &&
+			o->dataType != domain && o->size <= 8)
+	{
+		memcpy(&value, o->data, o->size);	/* little endian host */
+		fprintf(f, "0x%llX", (unsigned long long)value);
+		return;
+	}
+	for(i = 0 ; i < o->size ; i++)
+		fprintf(f, "%2.2X", (UNS8)o->data[i]);
+}
+
+static int Backup_mapping(UNS16 index)
+{
+	return (index >= 0x1600 && index <= 0x17FF) || (index >= 0x1A00 && index <= 0x1BFF);
+}
+
+static void Backup_entry(FILE* f, const Backup_object* o, UNS8 access)
+{
+	UNS8 dataType = o->dataType;
+
+	/* Values written in hex are reloaded as domains */
+	if (dataType == octet_string || dataType == unicode_string ||
+			(dataType != visible_string && dataType != domain && o->size > 8))
+		dataType = domain;
+	fprintf(f, "ObjectType=0x7\nDataType=0x%4.4X\nAccessType=%s\nPDOMapping=0\nParameterValue=",
+			dataType, access == RO ? "ro" : "rw");
+	Backup_value(f, o);
+	fprintf(f, "\n\n");
+}
+
+/* DCF of one node: a VAR per index read at subindex 0 only, otherwise a
+ * RECORD with the subindexes read */
+static int Backup_write(const char* path, const Backup_job* job)
+{
+	const Backup_object *o = job->objects;
+	FILE *f = fopen(path, "w");
+	time_t now = time(NULL);
+	char date[64];
+	int first;
+	int last;
+	int i;
+
+	if (!f)
+		return -1;
+	strftime(date, sizeof(date), "CreationDate=%m-%d-%Y\nCreationTime=%I:%M%p", localtime(&now));
+	fprintf(f, "[FileInfo]\nFileName=%s\n%s\nCreatedBy=CANOpenShell\n"
+			"Description=Backup of node 0x%2.2X\n\n", path, date, job->report->nodeId);
+	fprintf(f, "[DeviceComissioning]\nNodeID=0x%2.2X\n\n", job->report->nodeId);
+
+	for(first = 0 ; first < job->count ; first = last)
+	{
+		for(last = first + 1 ; last < job->count && o[last].index == o[first].index ; last++)
+			;
+		if (last - first == 1 && o[first].subIndex == 0)
+		{
+			fprintf(f, "[%4.4X]\nParameterName=Object %4.4X\n", o[first].index, o[first].index);
+			Backup_entry(f, &o[first], Backup_readonly(o[first].index) ? RO : o[first].access);
+			continue;
+		}
+		fprintf(f, "[%4.4X]\nParameterName=Object %4.4X\nObjectType=0x9\nSubNumber=%d\n\n",
+				o[first].index, o[first].index, last - first);
+		for(i = first ; i < last ; i++)
+		{
+			fprintf(f, "[%4.4Xsub%X]\nParameterName=Subindex %d\n", o[i].index, o[i].subIndex,
+					o[i].subIndex);
+			/* The number of subindexes is not written back either,
+			 * except the number of entries of a PDO mapping */
+			Backup_entry(f, &o[i], Backup_readonly(o[i].index) ||
+					(o[i].subIndex == 0 && !Backup_mapping(o[i].index)) ? RO : o[i].access);
+		}
+	}
+	return fclose(f) ? -1 : 0;
+}
+
+long Backup_nodes(CO_Data* d, const UNS8* nodes, int count, const char* prefix, const char* eds,
+		Backup_report* reports, FILE* out)
+{
+	Backup_job *jobs = calloc(count, sizeof(Backup_job));
+	EDS_object *list = NULL;
+	char path[1024];
+	UNS64 start;
+	long elapsed = -1;
+	int pending = 0;
+	int line;
+	int n = 0;
+	int i;
+	int j;
+
+	if (!jobs)
+		return -1;
+	if (eds && (n = EDS_objects(eds, nodes[0], &list, &line)) < 0)
+	{
+		if (line)
+			fprintf(out, "%s:%d: syntax error\n", eds, line);
+		else
+			perror(eds);
+		free(jobs);
+		return -1;
+	}
+
+	for(i = 0 ; i < count ; i++)
+	{
+		memset(&reports[i], 0, sizeof(Backup_report));
+		reports[i].nodeId = nodes[i];
+		jobs[i].report = &reports[i];
+		jobs[i].list = list;
+		jobs[i].n = n;
+		jobs[i].index = Backup_ranges[0].first;
+		jobs[i].pending = &pending;
+		jobs[i].req = SDO_read_request(nodes[i], 0, 0, 0, 0);
+		if (!jobs[i].req)
+			goto done;
+		jobs[i].req->timeout = BACKUP_TIMEOUT_US;
+		jobs[i].req->maxRequeues = SDO_MAX_REQUEUES;	/* lines held by silent nodes */
+		jobs[i].req->useCache = 0;	/* the values of the node, not of the cache */
+		jobs[i].req->callback = Backup_callback;
+		jobs[i].req->user = &jobs[i];
+	}
+
+	/* Every node at once, the first read of each on its own channel */
+	start = SDO_now();
+	pending = count;
+	EnterMutex();
+	for(i = 0 ; i < count ; i++)
+	{
+		jobs[i].start = start;
+		if (list)
+			Backup_next_listed(d, &jobs[i]);
+		else
+			Backup_read(d, &jobs[i], jobs[i].index, 0, 0, 0);
+	}
+	LeaveMutex();
+	pthread_mutex_lock(&Backup_lock);
+	while (pending)
+		pthread_cond_wait(&Backup_cond, &Backup_lock);
+	pthread_mutex_unlock(&Backup_lock);
+	elapsed = (SDO_now() - start) / 1000;
+
+	for(i = 0 ; i < count ; i++)
+	{
+		if (!reports[i].present)
+			continue;
+		snprintf(path, sizeof(path), "%s%2.2x.dcf", prefix, nodes[i]);
+		if (Backup_write(path, &jobs[i]) == 0)
+			reports[i].saved = 1;
+		else
+			fprintf(out, "%s: %s\n", path, strerror(errno));
+	}
+
+done:
+	for(i = 0 ; i < count ; i++)
+	{
+		for(j = 0 ; j < jobs[i].count ; j++)
+			free(jobs[i].objects[j].data);
+		free(jobs[i].objects);
+		SDO_free(jobs[i].req);
+	}
+	free(jobs);
+	free(list);
+	return elapsed;
+}
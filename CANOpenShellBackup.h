@@ -0,0 +1,57 @@
+/*
+This file is part of CanFestival, a library implementing CanOpen Stack.
+
+Copyright (C): Edouard TISSERANT and Francis DUPIN
+
+See COPYING file for copyrights details.
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+
+
+#ifndef CANOPENSHELLBACKUP_H
+#define CANOPENSHELLBACKUP_H
+
+#include <stdio.h>
+
+#include "canfestival.h"
+#include "CANOpenShellSDO.h"
+
+#define BACKUP_TIMEOUT_US 200000
+
+typedef struct {
+	UNS8 nodeId;
+	UNS8 present;		/* answered at least one read */
+	UNS8 saved;		/* snapshot written */
+	UNS32 objects;		/* read and saved */
+	UNS32 failed;		/* listed in the EDS but not readable */
+	UNS32 bytes;
+	UNS32 abortCode;	/* first failed read */
+	UNS64 elapsed;		/* us from the start to the last answer */
+} Backup_report;
+
+/* Upload the object dictionary of several nodes at once, each on its own
+ * client SDO channel, into one DCF per node named <prefix><nodeid>.dcf.
+ * The objects are those of the EDS file when given (strings and domains
+ * by block transfer), otherwise found by probing the communication
+ * profile (0x1000 - 0x1029, SDO and PDO parameters) and the first
+ * indexes of the manufacturer and device profile areas. A node that
+ * stops answering ends its own backup. Failures are printed on out.
+ * Returns the total time in us, or -1 if the EDS cannot be loaded.
+ * Must be called WITHOUT the stack mutex held. */
+long Backup_nodes(CO_Data* d, const UNS8* nodes, int count, const char* prefix, const char* eds,
+		Backup_report* reports, FILE* out);
+
+#endif // CANOPENSHELLBACKUP_H
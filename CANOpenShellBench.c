@@ -0,0 +1,318 @@
+/*
+This file is part of CanFestival, a library implementing CanOpen Stack.
+
+Copyright (C): Edouard TISSERANT and Francis DUPIN
+
+See COPYING file for copyrights details.
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+
+
+/* SDO benchmark: round-trip latency and throughput of the blocking
+ * SDO_read()/SDO_write() the shell uses, for expedited, segmented and
+ * block transfers of growing payloads to a growing number of nodes.
+ *
+ *   CANOpenShellBench [load#CanLibraryPath,channel,baudrate] [nodes#n] [count#n] [obj#index,subindex]
+ *
+ * Nodes 1 to n (default 8) are benchmarked, each by its own thread doing
+ * count (default 100) transfers per case. The object (default 0x2000,0)
+ * must accept domain writes of up to 1024 bytes. Without load# the
+ * simulated bus libcanfestival_can_shellsim.so is used with nodes 1 to n.
+ *
+ * It first compares the object dictionary lookup of the generated
+ * scanIndexOD switch with the table of CANOpenShellODIndex.c.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#include "canfestival.h"
+#include "CANOpenShellMasterOD.h"
+#include "CANOpenShellSDO.h"
+#include "CANOpenShellODIndex.h"
+
+#define BENCH_MAX_SIZE 1024
+#define BENCH_LOOKUP_ROUNDS 20000
+
+typedef struct {
+	const char *name;
+	UNS8 write;
+	UNS8 useBlockMode;
+	UNS32 size;
+} Bench_case;
+
+static const Bench_case Bench_cases[] = {
+	{ "expedited", 1, 0, 4 },
+	{ "expedited", 0, 0, 4 },
+	{ "segmented", 1, 0, 32 },
+	{ "segmented", 0, 0, 32 },
+	{ "segmented", 1, 0, 256 },
+	{ "segmented", 0, 0, 256 },
+	{ "segmented", 1, 0, 1024 },
+	{ "segmented", 0, 0, 1024 },
+	{ "block", 1, 1, 32 },
+	{ "block", 0, 1, 32 },
+	{ "block", 1, 1, 256 },
+	{ "block", 0, 1, 256 },
+	{ "block", 1, 1, 1024 },
+	{ "block", 0, 1, 1024 },
+};
+
+typedef struct {
+	pthread_t thread;
+	UNS8 nodeId;
+	const Bench_case *c;
+	UNS32 count;
+	UNS64 *latency;		/* ns, one per transfer */
+	UNS32 errors;
+	UNS32 abortCode;	/* of the last error */
+} Bench_worker;
+
+static CO_Data* d = &CANOpenShellMasterOD_Data;
+static char LibraryPath[512] = "./libcanfestival_can_shellsim.so";
+static char BoardBusName[31];
+static char BoardBaudRate[5] = "1M";
+static s_BOARD Board = {BoardBusName, BoardBaudRate};
+static UNS16 Index = 0x2000;
+static UNS8 SubIndex = 0x00;
+
+static int Compare(const void* a, const void* b)
+{
+	UNS64 x = *(const UNS64*)a;
+	UNS64 y = *(const UNS64*)b;
+
+	return x < y ? -1 : x > y;
+}
+
+static void* Worker(void* arg)
+{
+	Bench_worker *w = arg;
+	char data[BENCH_MAX_SIZE];
+	UNS32 size;
+	UNS32 abortCode;
+	UNS8 res;
+	UNS64 start;
+	UNS32 i;
+
+	memset(data, w->nodeId, sizeof(data));
+	for(i = 0 ; i < w->count ; i++)
+	{
+		start = SDO_now();
+		if (w->c->write)
+			res = SDO_write(d, w->nodeId, Index, SubIndex, w->c->size, domain, data,
+					w->c->useBlockMode, &abortCode);
+		else
+		{
+			size = sizeof(data);
+			res = SDO_read(d, w->nodeId, Index, SubIndex, domain, w->c->useBlockMode,
+					data, &size, &abortCode);
+			if (res == SDO_FINISHED && size != w->c->size)
+			{
+				res = SDO_ABORTED_INTERNAL;
+				abortCode = 0;
+			}
+		}
+		w->latency[i] = SDO_now() - start;
+		if (res != SDO_FINISHED)
+		{
+			w->errors++;
+			w->abortCode = abortCode;
+		}
+	}
+	return NULL;
+}
+
+/* Run one case on nodes 1 to nodes and print its line */
+static void Run(const Bench_case* c, int nodes, UNS32 count, UNS64* latency)
+{
+	Bench_worker workers[MAX_NODES];
+	UNS32 errors = 0;
+	UNS32 abortCode = 0;
+	UNS32 n = nodes * count;
+	UNS64 start;
+	double elapsed;
+	int i;
+
+	start = SDO_now();
+	for(i = 0 ; i < nodes ; i++)
+	{
+		workers[i].nodeId = i + 1;
+		workers[i].c = c;
+		workers[i].count = count;
+		workers[i].latency = latency + i * count;
+		workers[i].errors = 0;
+		workers[i].abortCode = 0;
+		pthread_create(&workers[i].thread, NULL, Worker, &workers[i]);
+	}
+	for(i = 0 ; i < nodes ; i++)
+	{
+		pthread_join(workers[i].thread, NULL);
+		errors += workers[i].errors;
+		if (workers[i].errors)
+			abortCode = workers[i].abortCode;
+	}
+	elapsed = (SDO_now() - start) / 1e9;
+
+	qsort(latency, n, sizeof(UNS64), Compare);
+	printf("%-9s  %-8s  %5u  %5d  %8.0f  %8.0f  %8.0f  %9.0f  %10.0f  %6u",
+			c->name, c->write ? "download" : "upload", c->size, nodes,
+			latency[n / 2] / 1e3, latency[(n * 99) / 100] / 1e3, latency[n - 1] / 1e3,
+			n / elapsed, (double)n * c->size / elapsed, errors);
+	if (errors)
+		printf("  (abort %8.8x)", abortCode);
+	printf("\n");
+	fflush(stdout);
+}
+
+/* ns per lookup of every index of the dictionary and as many absent ones */
+static double Lookup(scanIndexOD_t scan, const UNS16* keys, UNS32 n)
+{
+	const indextable * volatile sink;
+	ODCallback_t *callbacks;
+	UNS32 errorCode;
+	UNS64 start;
+	UNS32 r;
+	UNS32 i;
+
+	start = SDO_now();
+	for(r = 0 ; r < BENCH_LOOKUP_ROUNDS ; r++)
+		for(i = 0 ; i < n ; i++)
+			sink = scan(keys[i], &errorCode, &callbacks);
+	(void)sink;
+	return (double)(SDO_now() - start) / ((double)BENCH_LOOKUP_ROUNDS * n);
+}
+
+static void LookupBench(scanIndexOD_t generated)
+{
+	UNS16 size = *d->ObjdictSize;
+	UNS16 *keys = malloc(2 * size * sizeof(UNS16));
+	ODCallback_t *c1;
+	ODCallback_t *c2;
+	UNS32 e1;
+	UNS32 e2;
+	UNS32 mismatches = 0;
+	UNS32 index;
+	UNS16 i;
+
+	if (!keys)
+		return;
+	for(i = 0 ; i < size ; i++)
+	{
+		keys[2 * i] = d->objdict[i].index;
+		keys[2 * i + 1] = d->objdict[i].index ^ 0x0800;
+	}
+	for(index = 0 ; index <= 0xFFFF ; index++)
+		if (generated(index, &e1, &c1) != ODIndex_scan(index, &e2, &c2) || e1 != e2 || c1 != c2)
+			mismatches++;
+
+	printf("OD lookup (%u objects): switch %.1f ns, table %.1f ns, %u mismatches\n\n", size,
+			Lookup(generated, keys, 2 * size), Lookup(ODIndex_scan, keys, 2 * size), mismatches);
+	free(keys);
+}
+
+static void Init(CO_Data* d, UNS32 id)
+{
+	setState(d, Initialisation);
+	stopSYNC(d);
+}
+
+static void Exit(CO_Data* d, UNS32 id)
+{
+	setState(d, Stopped);
+}
+
+int main(int argc, char** argv)
+{
+	int nodes = 8;
+	UNS32 count = 100;
+	unsigned int index;
+	unsigned int subIndex;
+	UNS64 *latency;
+	scanIndexOD_t generated;
+	int loaded = 0;
+	size_t i;
+	int n;
+
+	for(n = 1 ; n < argc ; n++)
+	{
+		if (strncmp(argv[n], "load#", 5) == 0)
+		{
+			if (sscanf(argv[n], "load#%511[^,],%30[^,],%4[^,]", LibraryPath, BoardBusName, BoardBaudRate) < 2)
+				goto usage;
+			loaded = 1;
+		}
+		else if (sscanf(argv[n], "nodes#%d", &nodes) == 1 && nodes > 0 && nodes <= MAX_NODES)
+			;
+		else if (sscanf(argv[n], "count#%u", &count) == 1 && count > 0)
+			;
+		else if (sscanf(argv[n], "obj#%x,%x", &index, &subIndex) == 2)
+		{
+			Index = index;
+			SubIndex = subIndex;
+		}
+		else
+			goto usage;
+	}
+	if (!loaded)
+		snprintf(BoardBusName, sizeof(BoardBusName), "bench:01-%02x", nodes);
+
+	generated = d->scanIndexOD;
+	if (ODIndex_install(d) == 0)
+		LookupBench(generated);
+
+	latency = malloc(nodes * count * sizeof(UNS64));
+	if (!latency || SDO_init() == -1)
+	{
+		perror("CANOpenShellBench");
+		return 1;
+	}
+
+	TimerInit();
+	if (!LoadCanDriver(LibraryPath) || !canOpen(&Board, d))
+	{
+		fprintf(stderr, "Cannot open %s on %s\n", LibraryPath, BoardBusName);
+		TimerCleanup();
+		return 1;
+	}
+	setNodeId(d, 0);
+	StartTimerLoop(&Init);
+	/* Let the nodes boot */
+	sleep(1);
+
+	printf("%s %s, %d nodes, %u transfers per node and case, object %4.4x,%2.2x\n",
+			LibraryPath, BoardBaudRate, nodes, count, Index, SubIndex);
+	printf("%-9s  %-8s  %5s  %5s  %8s  %8s  %8s  %9s  %10s  %6s\n", "transfer", "op", "bytes", "nodes",
+			"p50 us", "p99 us", "max us", "xfer/s", "bytes/s", "errors");
+	for(i = 0 ; i < sizeof(Bench_cases) / sizeof(Bench_cases[0]) ; i++)
+	{
+		for(n = 1 ; n < nodes ; n *= 2)
+			Run(&Bench_cases[i], n, count, latency);
+		Run(&Bench_cases[i], nodes, count, latency);
+	}
+
+	StopTimerLoop(&Exit);
+	canClose(d);
+	TimerCleanup();
+	free(latency);
+	return 0;
+
+usage:
+	fprintf(stderr, "Usage: %s [load#CanLibraryPath,channel,baudrate] [nodes#n] [count#n] [obj#index,subindex]\n", argv[0]);
+	return 1;
+}
@@ -0,0 +1,186 @@
+/*
+This file is part of CanFestival, a library implementing CanOpen Stack.
+
+Copyright (C): Edouard TISSERANT and Francis DUPIN
+
+See COPYING file for copyrights details.
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+
+
+#include <string.h>
+
+#include "CANOpenShellCache.h"
+#include "CANOpenShellSDO.h"
+
+#define CACHE_KEY(n, i, s) ((UNS32)(n) << 24 | (UNS32)(i) << 8 | (s))
+#define CACHE_PROBES 16
+
+int Cache_bypass = 0;
+
+static Cache_entry Cache_table[CACHE_SIZE];
+static UNS32 Cache_epochs[MAX_NODES + 1];
+static Cache_stats Cache_counters;
+
+int Cache_static(UNS16 index)
+{
+	if (index < 0x1000 || index > 0x1FFF)
+		return 0;
+	switch(index)
+	{
+		case 0x1001:	/* error register */
+		case 0x1002:	/* manufacturer status */
+		case 0x1003:	/* error history */
+		case 0x1010:	/* store parameters */
+		case 0x1011:	/* restore defaults */
+		case 0x1013:	/* high resolution time stamp */
+		case 0x1023:	/* OS command */
+		case 0x1024:	/* OS command mode */
+		case 0x1025:	/* OS debugger */
+			return 0;
+	}
+	/* program download and control */
+	return index < 0x1F50 || index > 0x1F5F;
+}
+
+static UNS32 Cache_hash(UNS32 key)
+{
+	key *= 0x9E3779B1u;
+	return key >> 20;	/* 12 bits: CACHE_SIZE */
+}
+
+static int Cache_valid(const Cache_entry* e)
+{
+	return e->key && e->epoch == Cache_epochs[e->key >> 24];
+}
+
+static Cache_entry* Cache_find(UNS32 key)
+{
+	UNS32 h = Cache_hash(key);
+	int i;
+
+	for(i = 0 ; i < CACHE_PROBES ; i++)
+	{
+		Cache_entry *e = &Cache_table[(h + i) & (CACHE_SIZE - 1)];
+
+		if (e->key == key)
+			return e;
+		if (!e->key)
+			break;
+	}
+	return NULL;
+}
+
+const Cache_entry* Cache_lookup(UNS8 nodeId, UNS16 index, UNS8 subIndex)
+{
+	Cache_entry *e;
+
+	if (Cache_bypass || nodeId == 0 || nodeId > MAX_NODES || !Cache_static(index))
+		return NULL;
+	e = Cache_find(CACHE_KEY(nodeId, index, subIndex));
+	if (e && Cache_valid(e))
+	{
+		Cache_counters.hits++;
+		return e;
+	}
+	Cache_counters.misses++;
+	return NULL;
+}
+
+void Cache_store(UNS8 nodeId, UNS16 index, UNS8 subIndex, const void* data, UNS32 size)
+{
+	UNS32 key = CACHE_KEY(nodeId, index, subIndex);
+	UNS32 h = Cache_hash(key);
+	Cache_entry *e = Cache_find(key);
+	int i;
+
+	if (nodeId == 0 || nodeId > MAX_NODES || !Cache_static(index) || size > CACHE_DATA_SIZE)
+		return;
+	/* Same key, else first free or stale slot */
+	for(i = 0 ; !e && i < CACHE_PROBES ; i++)
+	{
+		e = &Cache_table[(h + i) & (CACHE_SIZE - 1)];
+		if (e->key && Cache_valid(e))
+			e = NULL;
+	}
+	if (!e)
+		return;
+	e->key = key;
+	e->epoch = Cache_epochs[nodeId];
+	e->size = size;
+	memcpy(e->data, data, size);
+	Cache_counters.stores++;
+}
+
+void Cache_forget(UNS8 nodeId, UNS16 index, UNS8 subIndex)
+{
+	Cache_entry *e = Cache_find(CACHE_KEY(nodeId, index, subIndex));
+
+	if (e)
+		e->epoch--;	/* stale, the slot stays in the probe chain */
+}
+
+void Cache_invalidate(UNS8 nodeId)
+{
+	int i;
+
+	if (nodeId > MAX_NODES)
+		return;
+	if (nodeId)
+		Cache_epochs[nodeId]++;
+	else
+		for(i = 1 ; i <= MAX_NODES ; i++)
+			Cache_epochs[i]++;
+	Cache_counters.invalidations++;
+}
+
+void Cache_get_stats(Cache_stats* stats)
+{
+	int i;
+
+	*stats = Cache_counters;
+	stats->entries = 0;
+	for(i = 0 ; i < CACHE_SIZE ; i++)
+		if (Cache_valid(&Cache_table[i]))
+			stats->entries++;
+}
+
+void Cache_print(FILE* out)
+{
+	Cache_stats stats;
+	UNS32 lookups;
+
+	Cache_get_stats(&stats);
+	lookups = stats.hits + stats.misses;
+	fprintf(out, "SDO cache%s: %u hits, %u misses (%.1f%% hits), %u entries, %u stores, %u invalidations\n",
+			Cache_bypass ? " (bypassed)" : "", stats.hits, stats.misses,
+			lookups ? 100.0 * stats.hits / lookups : 0.0,
+			stats.entries, stats.stores, stats.invalidations);
+}
+
+void Cache_post_SlaveStateChange(CO_Data* d, UNS8 nodeId, e_nodeState newNodeState)
+{
+	(void)d;
+	/* Boot-up message, or heartbeat/guarding lost */
+	if (newNodeState == Initialisation || newNodeState == Disconnected || newNodeState == Unknown_state)
+		Cache_invalidate(nodeId);
+}
+
+void Cache_heartbeatError(CO_Data* d, UNS8 nodeId)
+{
+	(void)d;
+	Cache_invalidate(nodeId);
+}
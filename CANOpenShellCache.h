@@ -0,0 +1,70 @@
+/*
+This file is part of CanFestival, a library implementing CanOpen Stack.
+
+Copyright (C): Edouard TISSERANT and Francis DUPIN
+
+See COPYING file for copyrights details.
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+
+
+#ifndef CANOPENSHELLCACHE_H
+#define CANOPENSHELLCACHE_H
+
+#include <stdio.h>
+
+#include "canfestival.h"
+
+#define CACHE_SIZE 4096		/* entries, power of two */
+#define CACHE_DATA_SIZE 64	/* longer values always go to the bus */
+
+/* Last value uploaded from one object of a node. Entries of a node are
+ * dropped together by bumping the node epoch. */
+typedef struct {
+	UNS32 key;		/* node << 24 | index << 8 | subindex, 0 when free */
+	UNS32 epoch;
+	UNS32 size;
+	UNS8 data[CACHE_DATA_SIZE];
+} Cache_entry;
+
+typedef struct {
+	UNS32 hits;
+	UNS32 misses;
+	UNS32 stores;
+	UNS32 invalidations;
+	UNS32 entries;		/* valid now */
+} Cache_stats;
+
+extern int Cache_bypass;	/* uploads always go to the bus, still refreshing the cache */
+
+/* Objects that only change when the node reboots or is written: the
+ * communication profile (0x1000 - 0x1FFF) but for error, status,
+ * store/restore commands, OS interpreter and program download objects */
+int Cache_static(UNS16 index);
+
+/* All called with the stack mutex held */
+const Cache_entry* Cache_lookup(UNS8 nodeId, UNS16 index, UNS8 subIndex);
+void Cache_store(UNS8 nodeId, UNS16 index, UNS8 subIndex, const void* data, UNS32 size);
+void Cache_forget(UNS8 nodeId, UNS16 index, UNS8 subIndex);
+void Cache_invalidate(UNS8 nodeId);	/* 0: all nodes */
+void Cache_get_stats(Cache_stats* stats);
+void Cache_print(FILE* out);
+
+/* Stack callbacks of a node that rebooted or was lost */
+void Cache_post_SlaveStateChange(CO_Data* d, UNS8 nodeId, e_nodeState newNodeState);
+void Cache_heartbeatError(CO_Data* d, UNS8 nodeId);
+
+#endif // CANOPENSHELLCACHE_H
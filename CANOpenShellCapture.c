@@ -0,0 +1,187 @@
+/*
+This file is part of CanFestival, a library implementing CanOpen Stack.
+
+Copyright (C): Edouard TISSERANT and Francis DUPIN
+
+See COPYING file for copyrights details.
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+
+
+#include <stdio.h>
+#include <string.h>
+#include <pthread.h>
+#include <time.h>
+
+#include "CANOpenShellCapture.h"
+
+#define CAPTURE_MASK (CAPTURE_RING_SIZE - 1)
+#define CAPTURE_IDLE_NS 1000000l
+
+/* Single producer (CAN receive thread), single consumer (capture thread).
+ * head is only written by the producer and tail by the consumer. */
+static Capture_record Capture_ring[CAPTURE_RING_SIZE];
+static UNS32 Capture_head;
+static UNS32 Capture_tail;
+static UNS32 Capture_dropped;
+static UNS32 Capture_count;
+
+static UNS32 Capture_cobs[CAPTURE_COB_WORDS];	/* RPDO COB-IDs to capture */
+static volatile int Capture_on;
+static pthread_t Capture_thread;
+static Capture_sink_t Capture_sink;
+static void *Capture_user;
+static FILE *Capture_file;
+
+void Capture_frame(const Message* m, UNS64 timestamp)
+{
+	UNS32 head;
+	UNS32 tail;
+
+	if (!Capture_on || m->rtr || !(Capture_cobs[(m->cob_id & 0x7FF) >> 5] & (1u << (m->cob_id & 0x1F))))
+		return;
+
+	head = __atomic_load_n(&Capture_head, __ATOMIC_RELAXED);
+	tail = __atomic_load_n(&Capture_tail, __ATOMIC_ACQUIRE);
+	if (head - tail == CAPTURE_RING_SIZE)
+	{
+		Capture_dropped++;
+		return;
+	}
+	Capture_ring[head & CAPTURE_MASK].timestamp = timestamp;
+	Capture_ring[head & CAPTURE_MASK].m = *m;
+	__atomic_store_n(&Capture_head, head + 1, __ATOMIC_RELEASE);
+}
+
+static void Capture_print(const Capture_record* rec, void* user)
+{
+	int i;
+
+	fprintf(Capture_file, "%llu.%06llu %03x %d",
+			(unsigned long long)(rec->timestamp / 1000000000ull),
+			(unsigned long long)(rec->timestamp % 1000000000ull) / 1000,
+			rec->m.cob_id, rec->m.len);
+	for(i = 0 ; i < rec->m.len && i < 8 ; i++)
+		fprintf(Capture_file, " %2.2x", rec->m.data[i]);
+	fputc('\n', Capture_file);
+}
+
+/* Drain the ring, sleeping while it is empty */
+static UNS32 Capture_drain(void)
+{
+	UNS32 tail = __atomic_load_n(&Capture_tail, __ATOMIC_RELAXED);
+	UNS32 head = __atomic_load_n(&Capture_head, __ATOMIC_ACQUIRE);
+	UNS32 n = head - tail;
+
+	for(; tail != head ; tail++)
+		Capture_sink(&Capture_ring[tail & CAPTURE_MASK], Capture_user);
+	__atomic_store_n(&Capture_tail, tail, __ATOMIC_RELEASE);
+	Capture_count += n;
+	return n;
+}
+
+static void* Capture_loop(void* arg)
+{
+	struct timespec idle = {0, CAPTURE_IDLE_NS};
+
+	while (Capture_on)
+	{
+		if (Capture_drain())
+			continue;
+		if (Capture_file)
+			fflush(Capture_file);
+		nanosleep(&idle, NULL);
+	}
+	Capture_drain();
+	if (Capture_file)
+		fflush(Capture_file);
+	return NULL;
+}
+
+void Capture_rpdo_cobs(CO_Data* d, UNS32* cobs)
+{
+	UNS16 i;
+	UNS32 cob;
+
+	memset(cobs, 0, CAPTURE_COB_WORDS * sizeof(UNS32));
+	if (d->firstIndex->PDO_RCV)
+		for(i = d->firstIndex->PDO_RCV ; i <= d->lastIndex->PDO_RCV ; i++)
+		{
+			cob = *(UNS32*)d->objdict[i].pSubindex[1].pObject;
+			if (!(cob & 0x80000000))
+				cobs[(cob & 0x7FF) >> 5] |= 1u << (cob & 0x1F);
+		}
+}
+
+int Capture_start_sink(CO_Data* d, Capture_sink_t sink, void* user)
+{
+	if (Capture_on)
+		return -1;
+
+	Capture_rpdo_cobs(d, Capture_cobs);
+	Capture_head = Capture_tail = 0;
+	Capture_count = Capture_dropped = 0;
+	Capture_sink = sink;
+	Capture_user = user;
+	Capture_on = 1;
+	if (pthread_create(&Capture_thread, NULL, Capture_loop, NULL) != 0)
+	{
+		Capture_on = 0;
+		return -1;
+	}
+	return 0;
+}
+
+int Capture_start(CO_Data* d, const char* path)
+{
+	FILE *f;
+
+	/* The running consumer is still printing to Capture_file */
+	if (Capture_on)
+		return -1;
+	f = strcmp(path, "-") ? fopen(path, "w") : stdout;
+	if (!f)
+		return -1;
+	Capture_file = f;
+	if (Capture_start_sink(d, Capture_print, NULL) == 0)
+		return 0;
+	Capture_file = NULL;
+	if (f != stdout)
+		fclose(f);
+	return -1;
+}
+
+void Capture_stop(void)
+{
+	if (!Capture_on)
+		return;
+	Capture_on = 0;
+	pthread_join(Capture_thread, NULL);
+	if (Capture_file && Capture_file != stdout)
+		fclose(Capture_file);
+	Capture_file = NULL;
+}
+
+int Capture_running(void)
+{
+	return Capture_on;
+}
+
+void Capture_stats(UNS32* captured, UNS32* dropped)
+{
+	*captured = Capture_count;
+	*dropped = Capture_dropped;
+}
@@ -0,0 +1,54 @@
+/*
+This file is part of CanFestival, a library implementing CanOpen Stack.
+
+Copyright (C): Edouard TISSERANT and Francis DUPIN
+
+See COPYING file for copyrights details.
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+
+#ifndef CANOPENSHELLCAPTURE_H
+#define CANOPENSHELLCAPTURE_H
+
+#include "canfestival.h"
+
+#define CAPTURE_RING_SIZE 4096	/* records, power of two */
+#define CAPTURE_COB_WORDS (2048 / 32)
+
+typedef struct {
+	UNS64 timestamp;	/* CLOCK_MONOTONIC, ns */
+	Message m;
+} Capture_record;
+
+typedef void (*Capture_sink_t)(const Capture_record* rec, void* user);
+
+/* Start capturing the frames received on the RPDO COB-IDs of d (0x1400 -
+ * 0x15FF). Records go to a text file ("-" for stdout) or to sink, both
+ * called from the consumer thread, never from the CAN receive thread. */
+int Capture_start(CO_Data* d, const char* path);
+int Capture_start_sink(CO_Data* d, Capture_sink_t sink, void* user);
+void Capture_stop(void);
+int Capture_running(void);
+void Capture_stats(UNS32* captured, UNS32* dropped);
+
+/* Fill the COB-ID bitmap cobs (CAPTURE_COB_WORDS words) with the valid
+ * RPDO COB-IDs of d */
+void Capture_rpdo_cobs(CO_Data* d, UNS32* cobs);
+
+/* Producer side, called from the CAN receive thread for every frame */
+void Capture_frame(const Message* m, UNS64 timestamp);
+
+#endif // CANOPENSHELLCAPTURE_H
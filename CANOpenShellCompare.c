@@ -0,0 +1,317 @@
+/*
+This file is part of CanFestival, a library implementing CanOpen Stack.
+
+Copyright (C): Edouard TISSERANT and Francis DUPIN
+
+See COPYING file for copyrights details.
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+
+
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "CANOpenShellCompare.h"
+#include "CANOpenShellEDS.h"
+
+/* Result of one object of the baseline */
+#define COMPARE_UNREAD		0
+#define COMPARE_EQUAL		1
+#define COMPARE_DIFFERENT	2
+#define COMPARE_FAILED		3
+
+typedef struct {
+	UNS8 state;
+	UNS32 size;		/* of data */
+	UNS32 abortCode;
+	char *data;		/* live value when different */
+} Compare_result;
+
+/* Compare of one node, driven from the SDO callbacks: each answer queues
+ * the next read on the channel of the node at once, in stack context. */
+typedef struct {
+	Compare_report *report;
+	EDS_object *set;
+	int n;
+	int position;
+	Compare_result *results;
+	SDO_request *req;
+	UNS64 start;
+	int *pending;
+} Compare_job;
+
+static pthread_mutex_t Compare_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t Compare_cond = PTHREAD_COND_INITIALIZER;
+
+/* Fixed by the device: taken from the SDO cache when already read */
+static int Compare_identity(UNS16 index)
+{
+	return index == 0x1000 || index == 0x1008 || index == 0x1009 ||
+			index == 0x100A || index == 0x1018;
+}
+
+static int Compare_string(UNS8 dataType)
+{
+	return dataType == visible_string || dataType == octet_string ||
+			dataType == unicode_string || dataType == domain;
+}
+
+static UNS64 Compare_integer(const void* data, UNS32 size)
+{
+	UNS64 value = 0;
+
+	memcpy(&value, data, size < 8 ? size : 8);	/* little endian host */
+	return value;
+}
+
+/* Integers by value, whatever size the node answers with */
+static int Compare_equal(const EDS_object* o, const SDO_request* req)
+{
+	if (!Compare_string(o->dataType) && o->size <= 8 && req->size <= 8)
+		return Compare_integer(o->value, o->size) == Compare_integer(req->data, req->size);
+	return o->size == req->size && memcmp(o->value, req->data, o->size) == 0;
+}
+
+static void Compare_finish(Compare_job* job, UNS32 abortCode)
+{
+	if (abortCode && !job->report->abortCode)
+		job->report->abortCode = abortCode;
+	job->report->elapsed = (SDO_now() - job->start) / 1000;
+	pthread_mutex_lock(&Compare_lock);
+	--*job->pending;
+	pthread_cond_broadcast(&Compare_cond);
+	pthread_mutex_unlock(&Compare_lock);
+}
+
+static void Compare_next(CO_Data* d, Compare_job* job)
+{
+	const EDS_object *o;
+
+	if (job->position == job->n)
+	{
+		Compare_finish(job, 0);
+		return;
+	}
+	o = &job->set[job->position];
+	SDO_request_read(job->req, o->index, o->subIndex, o->dataType,
+			Compare_string(o->dataType) && o->size > 32);
+	job->req->useCache = Compare_identity(o->index);
+	SDO_enqueue(d, job->req);
+}
+
+/* Completion of the read of a job, stack mutex held */
+static void Compare_callback(CO_Data* d, SDO_request* req)
+{
+	Compare_job *job = req->user;
+	const EDS_object *o = &job->set[job->position];
+	Compare_result *r = &job->results[job->position];
+
+	if (req->result == SDO_ABORTED_INTERNAL)
+	{
+		/* No answer: absent, or gone since */
+		Compare_finish(job, req->abortCode);
+		return;
+	}
+	if (req->result == SDO_ABORTED_RCV && req->useBlockMode)
+	{
+		/* Node without block transfer: again segmented */
+		SDO_request_read(req, o->index, o->subIndex, o->dataType, 0);
+		SDO_enqueue(d, req);
+		return;
+	}
+
+	if (req->started)
+		job->report->present = 1;
+	if (req->result != SDO_FINISHED)
+	{
+		r->state = COMPARE_FAILED;
+		r->abortCode = req->abortCode;
+		job->report->failed++;
+		if (!job->report->abortCode)
+			job->report->abortCode = req->abortCode;
+	}
+	else
+	{
+		if (!req->started)
+			job->report->cached++;
+		if (Compare_equal(o, req))
+		{
+			r->state = COMPARE_EQUAL;
+			job->report->equal++;
+		}
+		else
+		{
+			r->state = COMPARE_DIFFERENT;
+			r->size = req->size;
+			r->data = malloc(req->size + 1);
+			if (r->data)
+				memcpy(r->data, req->data, req->size + 1);
+			job->report->different++;
+		}
+	}
+	job->position++;
+	Compare_next(d, job);
+}
+
+static void Compare_value(FILE* out, UNS8 dataType, const char* data, UNS32 size)
+{
+	if (dataType == visible_string)
+		fprintf(out, "\"%.*s\"", (int)size, data);
+	else if (!Compare_string(dataType) && size <= 8)
+		fprintf(out, "0x%llX", (unsigned long long)Compare_integer(data, size));
+	else
+		fprintf(out, "%u bytes", size);
+}
+
+/* One line per object not equal to the baseline */
+static void Compare_print(const Compare_job* job, FILE* out)
+{
+	const EDS_object *o;
+	const Compare_result *r;
+	UNS32 i;
+	int k;
+
+	for(k = 0 ; k < job->n ; k++)
+	{
+		o = &job->set[k];
+		r = &job->results[k];
+		if (r->state == COMPARE_EQUAL || r->state == COMPARE_UNREAD)
+			continue;
+		fprintf(out, "%2.2x  %4.4x:%2.2x  ", job->report->nodeId, o->index, o->subIndex);
+		if (r->state == COMPARE_FAILED)
+		{
+			fprintf(out, "read aborted %8.8x\n", r->abortCode);
+			continue;
+		}
+		Compare_value(out, o->dataType, o->value, o->size);
+		fprintf(out, " -> ");
+		if (!r->data)
+		{
+			fprintf(out, "%u bytes\n", r->size);
+			continue;
+		}
+		Compare_value(out, o->dataType, r->data, r->size);
+		if (Compare_string(o->dataType) && o->dataType != visible_string)
+		{
+			/* First byte that differs */
+			for(i = 0 ; i < o->size && i < r->size && ((UNS8*)o->value)[i] == (UNS8)r->data[i] ; i++)
+				;
+			fprintf(out, ", from byte %u", i);
+		}
+		fprintf(out, "\n");
+	}
+	if (job->position < job->n)
+		fprintf(out, "%2.2x  %d objects not read, %8.8x\n", job->report->nodeId,
+				job->n - job->position, job->report->abortCode);
+}
+
+/* The objects of the baseline to read: those with a value */
+static int Compare_load(const char* path, UNS8 nodeId, EDS_object** set, FILE* out)
+{
+	char name[1024];
+	int line;
+	int n;
+	int i;
+	int k = 0;
+
+	if (access(path, R_OK) != 0)
+	{
+		snprintf(name, sizeof(name), "%s%2.2x.dcf", path, nodeId);
+		path = name;
+	}
+	n = EDS_objects(path, nodeId, set, &line);
+	if (n < 0)
+	{
+		if (line)
+			fprintf(out, "%s:%d: syntax error\n", path, line);
+		else
+			perror(path);
+		return -1;
+	}
+	for(i = 0 ; i < n ; i++)
+		if ((*set)[i].value && (*set)[i].access != WO)
+			(*set)[k++] = (*set)[i];
+	return k;
+}
+
+long Compare_nodes(CO_Data* d, const UNS8* nodes, int count, const char* path,
+		Compare_report* reports, FILE* out)
+{
+	Compare_job *jobs = calloc(count, sizeof(Compare_job));
+	UNS64 start;
+	long elapsed = -1;
+	int pending = 0;
+	int i;
+	int k;
+
+	if (!jobs)
+		return -1;
+	for(i = 0 ; i < count ; i++)
+	{
+		memset(&reports[i], 0, sizeof(Compare_report));
+		reports[i].nodeId = nodes[i];
+	}
+	/* Every baseline before the first read */
+	for(i = 0 ; i < count ; i++)
+	{
+		jobs[i].report = &reports[i];
+		jobs[i].n = Compare_load(path, nodes[i], &jobs[i].set, out);
+		if (jobs[i].n < 0)
+			goto done;
+		reports[i].objects = jobs[i].n;
+		jobs[i].results = calloc(jobs[i].n + 1, sizeof(Compare_result));
+		jobs[i].req = SDO_read_request(nodes[i], 0, 0, 0, 0);
+		if (!jobs[i].results || !jobs[i].req)
+			goto done;
+		jobs[i].req->timeout = COMPARE_TIMEOUT_US;
+		jobs[i].req->maxRequeues = SDO_MAX_REQUEUES;	/* lines held by silent nodes */
+		jobs[i].req->callback = Compare_callback;
+		jobs[i].req->user = &jobs[i];
+		jobs[i].pending = &pending;
+	}
+
+	/* Every node at once, the first read of each on its own channel */
+	start = SDO_now();
+	pending = count;
+	EnterMutex();
+	for(i = 0 ; i < count ; i++)
+	{
+		jobs[i].start = start;
+		Compare_next(d, &jobs[i]);
+	}
+	LeaveMutex();
+	pthread_mutex_lock(&Compare_lock);
+	while (pending)
+		pthread_cond_wait(&Compare_cond, &Compare_lock);
+	pthread_mutex_unlock(&Compare_lock);
+	elapsed = (SDO_now() - start) / 1000;
+
+	for(i = 0 ; i < count ; i++)
+		Compare_print(&jobs[i], out);
+
+done:
+	for(i = 0 ; i < count ; i++)
+	{
+		for(k = 0 ; jobs[i].results && k < jobs[i].n ; k++)
+			free(jobs[i].results[k].data);
+		free(jobs[i].results);
+		free(jobs[i].set);
+		SDO_free(jobs[i].req);
+	}
+	free(jobs);
+	return elapsed;
+}
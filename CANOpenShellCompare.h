@@ -0,0 +1,58 @@
+/*
+This file is part of CanFestival, a library implementing CanOpen Stack.
+
+Copyright (C): Edouard TISSERANT and Francis DUPIN
+
+See COPYING file for copyrights details.
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+
+
+#ifndef CANOPENSHELLCOMPARE_H
+#define CANOPENSHELLCOMPARE_H
+
+#include <stdio.h>
+
+#include "canfestival.h"
+#include "CANOpenShellSDO.h"
+
+#define COMPARE_TIMEOUT_US 200000
+
+typedef struct {
+	UNS8 nodeId;
+	UNS8 present;		/* answered at least one read */
+	UNS32 objects;		/* in the baseline */
+	UNS32 equal;
+	UNS32 different;
+	UNS32 failed;		/* not readable */
+	UNS32 cached;		/* identity objects taken from the SDO cache */
+	UNS32 abortCode;	/* first failed read */
+	UNS64 elapsed;		/* us from the start to the last answer */
+} Compare_report;
+
+/* Read the objects of a baseline DCF or EDS having a value from several
+ * nodes at once and print on out the ones that differ, one line each:
+ * "node index:subindex baseline -> live". path is the baseline of every
+ * node ($NODEID evaluated per node) or, when no such file exists, the
+ * prefix of one baseline per node as saved by Backup_nodes(). Identity
+ * objects already read since the node booted come from the SDO cache. A
+ * node that stops answering ends its own compare. Returns the total time
+ * in us, or -1 if a baseline cannot be loaded. Must be called WITHOUT
+ * the stack mutex held. */
+long Compare_nodes(CO_Data* d, const UNS8* nodes, int count, const char* path,
+		Compare_report* reports, FILE* out);
+
+#endif // CANOPENSHELLCOMPARE_H
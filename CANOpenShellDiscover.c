@@ -0,0 +1,124 @@
+/*
+This file is part of CanFestival, a library implementing CanOpen Stack.
+
+Copyright (C): Edouard TISSERANT and Francis DUPIN
+
+See COPYING file for copyrights details.
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "CANOpenShellDiscover.h"
+
+static const struct {
+	UNS16 index;
+	UNS8 subIndex;
+	UNS8 field;
+} Discover_objects[DISCOVER_OBJECTS] = {
+	{0x1000, 0x00, DISCOVER_DEVICE_TYPE},
+	{0x1018, 0x01, DISCOVER_VENDOR},
+	{0x1018, 0x02, DISCOVER_PRODUCT},
+	{0x1018, 0x03, DISCOVER_REVISION},
+	{0x1018, 0x04, DISCOVER_SERIAL},
+};
+
+static SDO_request* Discover_submit(CO_Data* d, UNS8 nodeId, int object, UNS32 timeout_us)
+{
+	SDO_request *req = SDO_read_request(nodeId, Discover_objects[object].index,
+			Discover_objects[object].subIndex, uint32, 0);
+
+	if (!req)
+		return NULL;
+	req->timeout = timeout_us;
+	req->maxRequeues = SDO_MAX_REQUEUES;	/* lines held by silent nodes */
+	req->useCache = object != 0;	/* presence is asked to the node */
+	req->user = (void*)(long)object;
+	SDO_submit(d, req);
+	return req;
+}
+
+static void Discover_store(Discover_node* node, int object, const SDO_request* req)
+{
+	UNS32 value = 0;
+
+	memcpy(&value, req->data, req->size < 4 ? req->size : 4);
+	node->valid |= Discover_objects[object].field;
+	switch(object)
+	{
+		case 0: node->deviceType = value; break;
+		case 1: node->vendor = value; break;
+		case 2: node->product = value; break;
+		case 3: node->revision = value; break;
+		case 4: node->serial = value; break;
+	}
+}
+
+int Discover_scan(CO_Data* d, const UNS8* nodes, int count, UNS32 timeout_us, Discover_node* inventory)
+{
+	SDO_request **reqs;
+	SDO_request *req;
+	Discover_node *node;
+	UNS64 start = SDO_now();
+	int present = 0;
+	int object;
+	int i;
+	int k;
+
+	if (!timeout_us)
+		timeout_us = DISCOVER_TIMEOUT_US;
+	reqs = calloc(count * DISCOVER_OBJECTS, sizeof(SDO_request*));
+	if (!reqs)
+		return -1;
+
+	/* Presence first: absent nodes cost one timeout, all at the same time */
+	for(i = 0 ; i < count ; i++)
+	{
+		memset(&inventory[i], 0, sizeof(Discover_node));
+		inventory[i].nodeId = nodes[i];
+		reqs[i * DISCOVER_OBJECTS] = Discover_submit(d, nodes[i], 0, timeout_us);
+	}
+
+	while ((k = SDO_wait_any(reqs, count * DISCOVER_OBJECTS)) >= 0)
+	{
+		req = reqs[k];
+		reqs[k] = NULL;
+		node = &inventory[k / DISCOVER_OBJECTS];
+		object = (long)req->user;
+
+		if (req->result == SDO_FINISHED)
+		{
+			Discover_store(node, object, req);
+			node->elapsed = SDO_now() - start;
+			if (object == 0)
+			{
+				/* Identity reads queue up on the channel of the node */
+				node->present = 1;
+				present++;
+				for(i = 1 ; i < DISCOVER_OBJECTS ; i++)
+					reqs[k + i] = Discover_submit(d, node->nodeId, i, timeout_us);
+			}
+		}
+		else if (!node->abortCode)
+			node->abortCode = req->abortCode;	/* absent, SDO_NO_CHANNEL when not reachable at all */
+		SDO_free(req);
+	}
+
+	free(reqs);
+	return present;
+}
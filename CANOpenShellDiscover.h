@@ -0,0 +1,62 @@
+/*
+This file is part of CanFestival, a library implementing CanOpen Stack.
+
+Copyright (C): Edouard TISSERANT and Francis DUPIN
+
+See COPYING file for copyrights details.
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+
+
+#ifndef CANOPENSHELLDISCOVER_H
+#define CANOPENSHELLDISCOVER_H
+
+#include "canfestival.h"
+#include "CANOpenShellSDO.h"
+
+#define DISCOVER_TIMEOUT_US 100000	/* no answer to 0x1000: node absent */
+#define DISCOVER_OBJECTS 5
+
+/* Fields of Discover_node.valid */
+#define DISCOVER_DEVICE_TYPE	0x01
+#define DISCOVER_VENDOR		0x02
+#define DISCOVER_PRODUCT	0x04
+#define DISCOVER_REVISION	0x08
+#define DISCOVER_SERIAL		0x10
+
+/* Identity of one node: 0x1000 and 0x1018:01-04 */
+typedef struct {
+	UNS8 nodeId;
+	UNS8 present;		/* answered 0x1000 */
+	UNS8 valid;		/* DISCOVER_* read successfully */
+	UNS32 deviceType;
+	UNS32 vendor;
+	UNS32 product;
+	UNS32 revision;
+	UNS32 serial;
+	UNS32 abortCode;	/* first failed read */
+	UNS64 elapsed;		/* ns from the start of the scan to the last answer */
+} Discover_node;
+
+/* Probe the nodes in parallel, each on its own client SDO channel: 0x1000
+ * is read from every node at once with timeout_us (0 for the default),
+ * and the identity of each node answering is read as soon as it answers
+ * (from the SDO cache when already read since the node booted).
+ * Fills inventory[0..count-1] and returns the number of nodes present.
+ * Must be called WITHOUT the stack mutex held. */
+int Discover_scan(CO_Data* d, const UNS8* nodes, int count, UNS32 timeout_us, Discover_node* inventory);
+
+#endif // CANOPENSHELLDISCOVER_H
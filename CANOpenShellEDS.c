@@ -0,0 +1,663 @@
+/*
+This file is part of CanFestival, a library implementing CanOpen Stack.
+
+Copyright (C): Edouard TISSERANT and Francis DUPIN
+
+See COPYING file for copyrights details.
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <ctype.h>
+
+#include "CANOpenShellEDS.h"
+#include "CANOpenShellODIndex.h"
+
+#define EDS_MAIN 0		/* key of the object section, subindex s is s + 1 */
+#define EDS_VAR 0x07
+#define EDS_ARRAY 0x08
+#define EDS_RECORD 0x09
+#define EDS_ALIGN(n) (((n) + 7) & ~(size_t)7)
+#define EDS_PAD(n, a) (((n) + (a) - 1) & ~(size_t)((a) - 1))
+
+/* One [index] or [indexsubN] section, its strings point into the file */
+typedef struct {
+	UNS16 index;
+	UNS16 key;
+	UNS8 objectType;
+	UNS8 dataType;
+	UNS8 access;
+	UNS8 compact;		/* CompactSubObj */
+	UNS8 dcf;		/* value from ParameterValue */
+	const char *value;
+	int line;
+} EDS_entry;
+
+/* Contiguous dictionary, allocated once */
+typedef struct {
+	indextable *objdict;
+	subindex *subs;
+	ODCallback_t *callbacks;
+	ODCallback_t **indexCallbacks;
+	quick_index *first;
+	quick_index *last;
+	UNS16 *size;
+	s_PDO_status *pdoStatus;
+	TIMER_HANDLE *heartbeatTimers;
+	UNS8 *values;
+} EDS_arena;
+
+static int EDS_compare(const void* a, const void* b)
+{
+	const EDS_entry *x = a;
+	const EDS_entry *y = b;
+
+	if (x->index != y->index)
+		return x->index < y->index ? -1 : 1;
+	return x->key < y->key ? -1 : x->key > y->key;
+}
+
+static char* EDS_trim(char* s)
+{
+	char *end;
+
+	while (isspace((unsigned char)*s))
+		s++;
+	end = s + strlen(s);
+	while (end > s && isspace((unsigned char)end[-1]))
+		*--end = '\0';
+	return s;
+}
+
+static UNS8 EDS_access(const char* s)
+{
+	if (strcasecmp(s, "ro") == 0 || strcasecmp(s, "const") == 0)
+		return RO;
+	if (strcasecmp(s, "wo") == 0)
+		return WO;
+	return RW;
+}
+
+static UNS32 EDS_type_size(UNS8 dataType, const char* value)
+{
+	UNS32 len;
+
+	switch(dataType)
+	{
+		case boolean: case int8: case uint8: return 1;
+		case int16: case uint16: return 2;
+		case int24: case uint24: return 3;
+		case int32: case uint32: case real32: return 4;
+		case int40: case uint40: return 5;
+		case int48: case uint48: return 6;
+		case int56: case uint56: return 7;
+		case int64: case uint64: case real64: return 8;
+	}
+	/* strings and domains */
+	len = value ? strlen(value) : 0;
+	return len > EDS_STRING_SIZE ? len : EDS_STRING_SIZE;
+}
+
+/* Alignment of a sub-value inside its object, strings and domains are bytes */
+static UNS32 EDS_type_align(UNS8 dataType)
+{
+	switch(dataType)
+	{
+		case int16: case uint16: return 2;
+		case int24: case uint24: case int32: case uint32: case real32: return 4;
+		case int40: case uint40: case int48: case uint48: case int56: case uint56:
+		case int64: case uint64: case real64: return 8;
+	}
+	return 1;
+}
+
+/* Integer value, "$NODEID+0x180" and "0x180+$NODEID" included */
+static UNS64 EDS_integer(const char* s, UNS8 nodeId)
+{
+	const char *id;
+	char rest[64];
+	size_t len;
+
+	for(id = s ; *id && strncasecmp(id, "$NODEID", 7) != 0 ; id++)
+		;
+	if (!*id)
+		return strtoull(s, NULL, 0);
+	len = id - s;
+	if (len >= sizeof(rest))
+		len = sizeof(rest) - 1;
+	memcpy(rest, s, len);
+	rest[len] = '\0';
+	strncat(rest, id + 7, sizeof(rest) - len - 1);
+	for(len = 0 ; rest[len] ; len++)
+		if (rest[len] == '+')
+			rest[len] = ' ';
+	return nodeId + strtoull(rest, NULL, 0);
+}
+
+/* Bytes of a domain value written as hex digits ("0A1B2C"), 0 if not */
+static UNS32 EDS_hex_size(const char* s)
+{
+	size_t len = strlen(s);
+	size_t i;
+
+	if (!len || len % 2)
+		return 0;
+	for(i = 0 ; i < len ; i++)
+		if (!isxdigit((unsigned char)s[i]))
+			return 0;
+	return len / 2;
+}
+
+static void EDS_value(void* p, UNS8 dataType, UNS32 size, const char* s, UNS8 nodeId)
+{
+	UNS64 v;
+	UNS32 i;
+	unsigned int byte;
+
+	if (!s || !*s)
+		return;
+	switch(dataType)
+	{
+		case real32: *(REAL32*)p = strtod(s, NULL); return;
+		case real64: *(REAL64*)p = strtod(s, NULL); return;
+		case domain:
+			if (EDS_hex_size(s))
+			{
+				for(i = 0 ; i < size && sscanf(s + 2 * i, "%2x", &byte) == 1 ; i++)
+					((UNS8*)p)[i] = byte;
+				return;
+			}
+			/* fall through */
+		case visible_string: case octet_string: case unicode_string:
+			memcpy(p, s, strlen(s) < size ? strlen(s) : size);
+			return;
+	}
+	v = EDS_integer(s, nodeId);
+	switch(size)
+	{
+		case 1: *(UNS8*)p = v; break;
+		case 2: *(UNS16*)p = v; break;
+		case 4: *(UNS32*)p = v; break;
+		case 8: *(UNS64*)p = v; break;
+		default: memcpy(p, &v, size); break;	/* little endian host */
+	}
+}
+
+/* Parse the sections describing objects, in file order */
+static EDS_entry* EDS_parse(char* text, int* count, int* line)
+{
+	EDS_entry *entries = NULL;
+	EDS_entry *e = NULL;
+	int allocated = 0;
+	int n = 0;
+	char *next;
+	char *s;
+	char *key;
+	char *end;
+	unsigned long index;
+	unsigned long sub;
+	int lineNo = 0;
+
+	for(s = text ; s ; s = next)
+	{
+		next = strchr(s, '\n');
+		if (next)
+			*next++ = '\0';
+		lineNo++;
+		s = EDS_trim(s);
+		if (!*s || *s == ';')
+			continue;
+
+		if (*s == '[')
+		{
+			e = NULL;
+			index = strtoul(s + 1, &end, 16);
+			if (end != s + 5 || index == 0)
+				continue;	/* FileInfo, DeviceInfo, object lists... */
+			if (*end == ']')
+				sub = EDS_MAIN;
+			else if (strncasecmp(end, "sub", 3) == 0)
+				sub = strtoul(end + 3, &end, 16) + 1;
+			else
+				continue;
+			if (*end != ']' || sub > 0x100)
+				goto fail;
+			if (n == allocated)
+			{
+				EDS_entry *grown;
+
+				allocated = allocated ? allocated * 2 : 256;
+				grown = realloc(entries, allocated * sizeof(EDS_entry));
+				if (!grown)
+					goto fail;
+				entries = grown;
+			}
+			e = &entries[n++];
+			memset(e, 0, sizeof(*e));
+			e->index = index;
+			e->key = sub;
+			e->objectType = EDS_VAR;
+			e->access = RW;
+			e->line = lineNo;
+			continue;
+		}
+
+		key = s;
+		s = strchr(s, '=');
+		if (!s)
+			goto fail;
+		*s++ = '\0';
+		key = EDS_trim(key);
+		s = EDS_trim(s);
+		if (!e)
+			continue;
+		if (strcasecmp(key, "ObjectType") == 0)
+			e->objectType = strtoul(s, NULL, 0);
+		else if (strcasecmp(key, "DataType") == 0)
+			e->dataType = strtoul(s, NULL, 0);
+		else if (strcasecmp(key, "AccessType") == 0)
+			e->access = EDS_access(s);
+		else if (strcasecmp(key, "ParameterValue") == 0 && *s)
+		{
+			e->value = s;	/* DCF value wins over the default */
+			e->dcf = 1;
+		}
+		else if (strcasecmp(key, "DefaultValue") == 0 && !e->value)
+			e->value = s;
+		else if (strcasecmp(key, "CompactSubObj") == 0)
+			e->compact = strtoul(s, NULL, 0);
+	}
+	*count = n;
+	return entries;
+
+fail:
+	*line = lineNo;
+	free(entries);
+	return NULL;
+}
+
+/* Number of subindexes of the object starting at entries[i], and the
+ * number of entries it spans */
+static int EDS_subcount(const EDS_entry* entries, int n, int i, int* span)
+{
+	const EDS_entry *m = &entries[i];
+	int subs = 1;
+	int j;
+
+	for(j = i + 1 ; j < n && entries[j].index == m->index ; j++)
+		subs = entries[j].key;
+	*span = j - i;
+	if (m->key != EDS_MAIN || m->objectType == EDS_VAR || m->objectType == 0x02 || m->objectType == 0x05 || m->objectType == 0x06)
+		return m->key == EDS_MAIN ? 1 : 0;
+	if (*span == 1 && m->compact)
+		return m->compact + 1;
+	return *span > 1 ? subs : 0;
+}
+
+static UNS16 EDS_range(const indextable* objdict, int n, UNS16 low, UNS16 high, int last)
+{
+	int i;
+	int found = 0;
+
+	for(i = 0 ; i < n ; i++)
+		if (objdict[i].index >= low && objdict[i].index <= high)
+		{
+			found = i;
+			if (!last)
+				break;
+		}
+	return found;
+}
+
+static void* EDS_object_value(const indextable* objdict, int n, UNS16 index, UNS8 sub)
+{
+	int i;
+
+	for(i = 0 ; i < n ; i++)
+		if (objdict[i].index == index)
+			return sub < objdict[i].bSubCount ? objdict[i].pSubindex[sub].pObject : NULL;
+	return NULL;
+}
+
+/* Sorted sections of a file, *text holds their strings */
+static EDS_entry* EDS_read(const char* path, char** text, int* count, int* line)
+{
+	EDS_entry *entries;
+	FILE *f;
+	long length;
+
+	*line = 0;
+	f = fopen(path, "rb");
+	if (!f)
+		return NULL;
+	fseek(f, 0, SEEK_END);
+	length = ftell(f);
+	rewind(f);
+	*text = malloc(length + 1);
+	if (!*text || fread(*text, 1, length, f) != (size_t)length)
+	{
+		fclose(f);
+		free(*text);
+		return NULL;
+	}
+	fclose(f);
+	(*text)[length] = '\0';
+
+	entries = EDS_parse(*text, count, line);
+	if (!entries)
+	{
+		free(*text);
+		return NULL;
+	}
+	qsort(entries, *count, sizeof(EDS_entry), EDS_compare);
+	return entries;
+}
+
+/* Bytes of a value to download: strings as long as they are */
+static UNS32 EDS_value_size(const EDS_entry* e)
+{
+	switch(e->dataType)
+	{
+		case domain:
+			if (e->value && EDS_hex_size(e->value))
+				return EDS_hex_size(e->value);
+			/* fall through */
+		case visible_string: case octet_string: case unicode_string:
+			return e->value ? strlen(e->value) : 0;
+	}
+	return EDS_type_size(e->dataType, e->value);
+}
+
+int EDS_objects(const char* path, UNS8 nodeId, EDS_object** objects, int* line)
+{
+	EDS_entry *entries;
+	EDS_entry *e;
+	EDS_object *o;
+	char *text;
+	UNS8 *value;
+	size_t bytes = 0;
+	int count;
+	int n = 0;
+	int i;
+
+	entries = EDS_read(path, &text, &count, line);
+	if (!entries)
+		return -1;
+	/* VAR objects and sub-objects */
+	for(i = 0 ; i < count ; i++)
+	{
+		e = &entries[i];
+		if (e->key == EDS_MAIN && e->objectType != EDS_VAR)
+			continue;
+		n++;
+		if (e->value)
+			bytes += EDS_ALIGN(EDS_value_size(e));
+	}
+
+	*objects = calloc(1, EDS_ALIGN(n * sizeof(EDS_object)) + bytes);
+	if (!*objects)
+	{
+		free(entries);
+		free(text);
+		return -1;
+	}
+	o = *objects;
+	value = (UNS8*)*objects + EDS_ALIGN(n * sizeof(EDS_object));
+	for(i = 0 ; i < count ; i++)
+	{
+		e = &entries[i];
+		if (e->key == EDS_MAIN && e->objectType != EDS_VAR)
+			continue;
+		o->index = e->index;
+		o->subIndex = e->key == EDS_MAIN ? 0 : e->key - 1;
+		o->dataType = e->dataType;
+		o->access = e->access;
+		o->dcf = e->dcf;
+		o->size = EDS_value_size(e);
+		if (e->value)
+		{
+			o->value = value;
+			EDS_value(value, e->dataType, o->size, e->value, nodeId);
+			value += EDS_ALIGN(o->size);
+		}
+		o++;
+	}
+	free(entries);
+	free(text);
+	return n;
+}
+
+int EDS_load(CO_Data* d, const char* path, UNS8 nodeId, int* line)
+{
+	static const s_PDO_status pdoInit = s_PDO_status_Initializer;
+	static UNS8 empty;
+	EDS_entry *entries;
+	EDS_entry *sub;
+	EDS_arena a;
+	char *text;
+	int count;
+	int objects = 0;
+	int subs = 0;
+	int tpdos = 0;
+	int heartbeats = 0;
+	size_t valueBytes = 0;
+	size_t total;
+	UNS8 *arena;
+	UNS8 *value;
+	const indextable *previous;
+	const UNS16 *previousSize;
+	UNS32 size;
+	UNS32 align;
+	size_t offset;
+	int span;
+	int nsub;
+	int i;
+	int j;
+	int k;
+	int o;
+	int s;
+
+	entries = EDS_read(path, &text, &count, line);
+	if (!entries)
+		return -1;
+
+	/* Sizes */
+	for(i = 0 ; i < count ; i += span)
+	{
+		nsub = EDS_subcount(entries, count, i, &span);
+		if (!nsub)
+			continue;
+		objects++;
+		subs += nsub;
+		if (entries[i].index >= 0x1800 && entries[i].index <= 0x19FF)
+			tpdos++;
+		if (entries[i].index == 0x1016)
+			heartbeats = nsub - 1;
+		/* Sub-values are contiguous at their natural size, as the stack
+		 * walks ARRAY objects like 0x1003 and 0x1016 as C arrays */
+		offset = 0;
+		if (span == 1)
+		{
+			size = EDS_type_size(entries[i].dataType, entries[i].value);
+			align = EDS_type_align(entries[i].dataType);
+			offset = nsub > 1 ? 1 : 0;
+			offset = EDS_PAD(offset, align) + (nsub - (nsub > 1)) * size;
+		}
+		for(j = i + 1 ; j < i + span ; j++)
+		{
+			align = EDS_type_align(entries[j].dataType);
+			offset = EDS_PAD(offset, align) + EDS_type_size(entries[j].dataType, entries[j].value);
+		}
+		valueBytes += EDS_ALIGN(offset);
+	}
+	if (!objects || objects > 0xFFFF)
+	{
+		free(entries);
+		free(text);
+		return -1;
+	}
+
+	total = EDS_ALIGN(objects * sizeof(indextable)) + EDS_ALIGN(subs * sizeof(subindex)) +
+		EDS_ALIGN(subs * sizeof(ODCallback_t)) + EDS_ALIGN(objects * sizeof(ODCallback_t*)) +
+		EDS_ALIGN(2 * sizeof(quick_index)) + EDS_ALIGN(sizeof(UNS16)) +
+		EDS_ALIGN(tpdos * sizeof(s_PDO_status)) + EDS_ALIGN(heartbeats * sizeof(TIMER_HANDLE)) +
+		valueBytes;
+	arena = calloc(1, total);
+	if (!arena)
+	{
+		free(entries);
+		free(text);
+		return -1;
+	}
+	a.objdict = (indextable*)arena;
+	a.subs = (subindex*)((UNS8*)a.objdict + EDS_ALIGN(objects * sizeof(indextable)));
+	a.callbacks = (ODCallback_t*)((UNS8*)a.subs + EDS_ALIGN(subs * sizeof(subindex)));
+	a.indexCallbacks = (ODCallback_t**)((UNS8*)a.callbacks + EDS_ALIGN(subs * sizeof(ODCallback_t)));
+	a.first = (quick_index*)((UNS8*)a.indexCallbacks + EDS_ALIGN(objects * sizeof(ODCallback_t*)));
+	a.last = a.first + 1;
+	a.size = (UNS16*)((UNS8*)a.first + EDS_ALIGN(2 * sizeof(quick_index)));
+	a.pdoStatus = (s_PDO_status*)((UNS8*)a.size + EDS_ALIGN(sizeof(UNS16)));
+	a.heartbeatTimers = (TIMER_HANDLE*)((UNS8*)a.pdoStatus + EDS_ALIGN(tpdos * sizeof(s_PDO_status)));
+	a.values = (UNS8*)a.heartbeatTimers + EDS_ALIGN(heartbeats * sizeof(TIMER_HANDLE));
+
+	/* Fill */
+	value = a.values;
+	k = 0;
+	o = 0;
+	for(i = 0 ; i < count ; i += span)
+	{
+		nsub = EDS_subcount(entries, count, i, &span);
+		if (!nsub)
+			continue;
+		a.objdict[o].pSubindex = &a.subs[k];
+		a.objdict[o].bSubCount = nsub;
+		a.objdict[o].index = entries[i].index;
+		a.indexCallbacks[o] = &a.callbacks[k];
+		for(s = 0 ; s < nsub ; s++)
+		{
+			a.subs[k + s].bAccessType = RO;
+			a.subs[k + s].bDataType = domain;
+			a.subs[k + s].pObject = &empty;	/* hole in the subindexes */
+		}
+		offset = 0;
+		if (span == 1)
+		{
+			/* VAR, or ARRAY with CompactSubObj */
+			for(s = 0 ; s < nsub ; s++)
+			{
+				sub = &entries[i];
+				size = s == 0 && nsub > 1 ? 1 : EDS_type_size(sub->dataType, sub->value);
+				offset = EDS_PAD(offset, s == 0 && nsub > 1 ? 1 : EDS_type_align(sub->dataType));
+				a.subs[k + s].bAccessType = s == 0 && nsub > 1 ? RO : sub->access;
+				a.subs[k + s].bDataType = s == 0 && nsub > 1 ? uint8 : sub->dataType;
+				a.subs[k + s].size = size;
+				a.subs[k + s].pObject = value + offset;
+				if (s == 0 && nsub > 1)
+					value[offset] = nsub - 1;
+				else
+					EDS_value(value + offset, sub->dataType, size, sub->value, nodeId);
+				offset += size;
+			}
+		}
+		else
+			for(j = i + 1 ; j < i + span ; j++)
+			{
+				sub = &entries[j];
+				s = sub->key - 1;
+				size = EDS_type_size(sub->dataType, sub->value);
+				offset = EDS_PAD(offset, EDS_type_align(sub->dataType));
+				a.subs[k + s].bAccessType = sub->access;
+				a.subs[k + s].bDataType = sub->dataType;
+				a.subs[k + s].size = size;
+				a.subs[k + s].pObject = value + offset;
+				EDS_value(value + offset, sub->dataType, size, sub->value, nodeId);
+				offset += size;
+			}
+		value += EDS_ALIGN(offset);
+		k += nsub;
+		o++;
+	}
+
+	a.first->SDO_SVR = EDS_range(a.objdict, objects, 0x1200, 0x127F, 0);
+	a.last->SDO_SVR = EDS_range(a.objdict, objects, 0x1200, 0x127F, 1);
+	a.first->SDO_CLT = EDS_range(a.objdict, objects, 0x1280, 0x12FF, 0);
+	a.last->SDO_CLT = EDS_range(a.objdict, objects, 0x1280, 0x12FF, 1);
+	a.first->PDO_RCV = EDS_range(a.objdict, objects, 0x1400, 0x15FF, 0);
+	a.last->PDO_RCV = EDS_range(a.objdict, objects, 0x1400, 0x15FF, 1);
+	a.first->PDO_RCV_MAP = EDS_range(a.objdict, objects, 0x1600, 0x17FF, 0);
+	a.last->PDO_RCV_MAP = EDS_range(a.objdict, objects, 0x1600, 0x17FF, 1);
+	a.first->PDO_TRS = EDS_range(a.objdict, objects, 0x1800, 0x19FF, 0);
+	a.last->PDO_TRS = EDS_range(a.objdict, objects, 0x1800, 0x19FF, 1);
+	a.first->PDO_TRS_MAP = EDS_range(a.objdict, objects, 0x1A00, 0x1BFF, 0);
+	a.last->PDO_TRS_MAP = EDS_range(a.objdict, objects, 0x1A00, 0x1BFF, 1);
+	*a.size = objects;
+
+	/* Indexed first, so that a failure leaves d on its old dictionary */
+	previous = d->objdict;
+	previousSize = d->ObjdictSize;
+	d->objdict = a.objdict;
+	d->ObjdictSize = a.size;
+	if (ODIndex_install_callbacks(d, a.indexCallbacks) != 0)
+	{
+		d->objdict = previous;
+		d->ObjdictSize = previousSize;
+		free(arena);
+		free(entries);
+		free(text);
+		return -1;
+	}
+	d->firstIndex = a.first;
+	d->lastIndex = a.last;
+	if (tpdos)
+	{
+		for(i = 0 ; i < tpdos ; i++)
+			a.pdoStatus[i] = pdoInit;
+		d->PDO_status = a.pdoStatus;
+	}
+
+	/* Communication objects the stack reaches through CO_Data */
+#define EDS_REWIRE(field, index, sub) \
+	do { void *p = EDS_object_value(a.objdict, objects, index, sub); if (p) d->field = p; } while (0)
+	EDS_REWIRE(error_register, 0x1001, 0);
+	EDS_REWIRE(error_number, 0x1003, 0);
+	EDS_REWIRE(error_first_element, 0x1003, 1);
+	EDS_REWIRE(COB_ID_Sync, 0x1005, 0);
+	EDS_REWIRE(Sync_Cycle_Period, 0x1006, 0);
+	EDS_REWIRE(GuardTime, 0x100C, 0);
+	EDS_REWIRE(LifeTimeFactor, 0x100D, 0);
+	EDS_REWIRE(error_cobid, 0x1014, 0);
+	EDS_REWIRE(ProducerHeartBeatTime, 0x1017, 0);
+	for(o = 0 ; o < objects ; o++)
+		if (a.objdict[o].index == 0x1003 && a.objdict[o].bSubCount > 1)
+			d->error_history_size = a.objdict[o].bSubCount - 1;
+	if (heartbeats)
+	{
+		EDS_REWIRE(ConsumerHeartbeatCount, 0x1016, 0);
+		EDS_REWIRE(ConsumerHeartbeatEntries, 0x1016, 1);
+		for(i = 0 ; i < heartbeats ; i++)
+			a.heartbeatTimers[i] = TIMER_NONE;
+		d->ConsumerHeartBeatTimers = a.heartbeatTimers;
+	}
+#undef EDS_REWIRE
+
+	free(entries);
+	free(text);
+	return objects;
+}
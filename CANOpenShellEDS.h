@@ -0,0 +1,58 @@
+/*
+This file is part of CanFestival, a library implementing CanOpen Stack.
+
+Copyright (C): Edouard TISSERANT and Francis DUPIN
+
+See COPYING file for copyrights details.
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+
+
+#ifndef CANOPENSHELLEDS_H
+#define CANOPENSHELLEDS_H
+
+#include "canfestival.h"
+
+#define EDS_STRING_SIZE 32	/* minimum room for strings and domains */
+
+/* Replace the object dictionary of d by the objects of an EDS or DCF file
+ * (ParameterValue is used before DefaultValue, $NODEID is nodeId). The
+ * indextable, subindex tables, callbacks and values are laid out in one
+ * arena and the CO_Data pointers to communication objects (0x1001, 0x1003,
+ * 0x1005, 0x1006, 0x100C, 0x100D, 0x1014, 0x1016, 0x1017) are moved to it;
+ * objects missing from the file keep those of the generated dictionary.
+ * Returns the number of objects, or -1 with *line set to the offending
+ * line (0 when the file cannot be read). Call before the stack runs. */
+int EDS_load(CO_Data* d, const char* path, UNS8 nodeId, int* line);
+
+/* A value of an EDS or DCF file, to be downloaded to a node */
+typedef struct {
+	UNS16 index;
+	UNS8 subIndex;
+	UNS8 dataType;
+	UNS8 access;		/* RW, WO or RO */
+	UNS8 dcf;		/* from ParameterValue */
+	UNS32 size;		/* strings as long as their value */
+	void *value;		/* NULL when the file gives none */
+} EDS_object;
+
+/* Every VAR and sub-object of the file, in index and subindex order,
+ * $NODEID being nodeId. Domain values may be written as hex digits. *objects and the values are one
+ * allocation released with free(). Returns the number of objects or -1
+ * with *line set as for EDS_load(). */
+int EDS_objects(const char* path, UNS8 nodeId, EDS_object** objects, int* line);
+
+#endif // CANOPENSHELLEDS_H
@@ -0,0 +1,224 @@
+/*
+This file is part of CanFestival, a library implementing CanOpen Stack.
+
+Copyright (C): Edouard TISSERANT and Francis DUPIN
+
+See COPYING file for copyrights details.
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "CANOpenShellEmcy.h"
+
+static Emcy_node Emcy_nodes[MAX_NODES + 1];
+
+void Emcy_frame(const Message* m, UNS64 timestamp)
+{
+	Emcy_node *node;
+	Emcy_record *rec;
+	Emcy_counter *counter;
+	UNS16 code;
+	UNS32 i;
+
+	/* 0x080 is SYNC */
+	if (m->cob_id <= 0x080 || m->cob_id > 0x080 + MAX_NODES || m->rtr || m->len < 3)
+		return;
+	node = &Emcy_nodes[m->cob_id - 0x080];
+	code = m->data[0] | m->data[1] << 8;
+
+	if (timestamp - node->windowStart >= EMCY_RATE_WINDOW_MS * 1000000ull)
+	{
+		node->previous = timestamp - node->windowStart < 2 * EMCY_RATE_WINDOW_MS * 1000000ull ? node->window : 0;
+		node->windowStart = timestamp;
+		node->window = 0;
+	}
+	node->window++;
+
+	rec = &node->ring[node->total++ & (EMCY_HISTORY - 1)];
+	rec->timestamp = timestamp;
+	rec->code = code;
+	rec->errorRegister = m->data[2];
+	memset(rec->data, 0, sizeof(rec->data));
+	memcpy(rec->data, &m->data[3], (m->len > 8 ? 8 : m->len) - 3);
+
+	for(i = 0 ; i < node->codes && node->counters[i].code != code ; i++)
+		;
+	if (i == node->codes)
+	{
+		if (i == EMCY_CODES)
+		{
+			node->other++;
+			return;
+		}
+		node->codes++;
+		counter = &node->counters[i];
+		counter->code = code;
+		counter->count = 0;
+		counter->first = timestamp;
+	}
+	counter = &node->counters[i];
+	counter->count++;
+	counter->last = timestamp;
+}
+
+void Emcy_clear(void)
+{
+	memset(Emcy_nodes, 0, sizeof(Emcy_nodes));
+}
+
+static int Emcy_snapshot(UNS8 nodeId, Emcy_node* copy)
+{
+	EnterMutex();
+	*copy = Emcy_nodes[nodeId];
+	LeaveMutex();
+	return copy->total != 0;
+}
+
+/* Records of the ring, oldest first */
+static UNS32 Emcy_history(const Emcy_node* node, UNS32 i)
+{
+	UNS32 kept = node->total < EMCY_HISTORY ? node->total : EMCY_HISTORY;
+
+	return (node->total - kept + i) & (EMCY_HISTORY - 1);
+}
+
+/* EMCY per second of the node during the last full window */
+static double Emcy_recent_rate(const Emcy_node* node, UNS64 now)
+{
+	UNS64 window = EMCY_RATE_WINDOW_MS * 1000000ull;
+	UNS32 count = 0;
+
+	if (now - node->windowStart < window)
+		count = node->previous;
+	else if (now - node->windowStart < 2 * window)
+		count = node->window;
+	return count * 1000.0 / EMCY_RATE_WINDOW_MS;
+}
+
+static double Emcy_mean_rate(const Emcy_counter* counter)
+{
+	if (counter->count < 2 || counter->last == counter->first)
+		return 0.0;
+	return (counter->count - 1) * 1e9 / (counter->last - counter->first);
+}
+
+static void Emcy_print_node(FILE* out, UNS8 nodeId, const Emcy_node* node, UNS64 now)
+{
+	const Emcy_record *rec;
+	UNS32 kept = node->total < EMCY_HISTORY ? node->total : EMCY_HISTORY;
+	UNS32 i;
+
+	fprintf(out, "Node %2.2x: %u EMCY, %.1f/s recently\n", nodeId, node->total, Emcy_recent_rate(node, now));
+	fprintf(out, "  Code  Count     Mean(/s)  Last(s ago)\n");
+	for(i = 0 ; i < node->codes ; i++)
+	{
+		const Emcy_counter *c = &node->counters[i];
+
+		fprintf(out, "  %4.4x  %-8u  %-8.1f  %.3f\n", c->code, c->count, Emcy_mean_rate(c),
+				(now - c->last) / 1e9);
+	}
+	if (node->other)
+		fprintf(out, "  other %u\n", node->other);
+	fprintf(out, "  Time(s ago)  Code  Reg  Data\n");
+	for(i = 0 ; i < kept ; i++)
+	{
+		rec = &node->ring[Emcy_history(node, i)];
+		fprintf(out, "  %-11.3f  %4.4x  %2.2x   %2.2x %2.2x %2.2x %2.2x %2.2x\n",
+				(now - rec->timestamp) / 1e9, rec->code, rec->errorRegister,
+				rec->data[0], rec->data[1], rec->data[2], rec->data[3], rec->data[4]);
+	}
+}
+
+void Emcy_print(FILE* out, UNS8 nodeId)
+{
+	Emcy_node *node = malloc(sizeof(Emcy_node));
+	const Emcy_record *last;
+	UNS64 now = SDO_now();
+	int i;
+
+	if (!node)
+		return;
+	if (nodeId)
+	{
+		if (nodeId <= MAX_NODES && Emcy_snapshot(nodeId, node))
+			Emcy_print_node(out, nodeId, node, now);
+		else
+			fprintf(out, "No EMCY from node %2.2x\n", nodeId);
+		free(node);
+		return;
+	}
+
+	fprintf(out, "Node  Count     Codes  Last  Reg  Last(s ago)  Recent(/s)\n");
+	for(i = 1 ; i <= MAX_NODES ; i++)
+	{
+		if (!Emcy_snapshot(i, node))
+			continue;
+		last = &node->ring[(node->total - 1) & (EMCY_HISTORY - 1)];
+		fprintf(out, "%2.2x    %-8u  %-5u  %4.4x  %2.2x   %-11.3f  %.1f\n", i, node->total,
+				node->codes + (node->other != 0), last->code, last->errorRegister,
+				(now - last->timestamp) / 1e9, Emcy_recent_rate(node, now));
+	}
+	free(node);
+}
+
+int Emcy_export(const char* path)
+{
+	Emcy_node *node = malloc(sizeof(Emcy_node));
+	const Emcy_record *rec;
+	UNS32 kept;
+	FILE *out;
+	UNS32 j;
+	int i;
+
+	if (!node)
+		return -1;
+	out = fopen(path, "w");
+	if (!out)
+	{
+		free(node);
+		return -1;
+	}
+	fprintf(out, "# node\ttime_s\tcode\tregister\tdata\n");
+	for(i = 1 ; i <= MAX_NODES ; i++)
+	{
+		if (!Emcy_snapshot(i, node))
+			continue;
+		kept = node->total < EMCY_HISTORY ? node->total : EMCY_HISTORY;
+		for(j = 0 ; j < kept ; j++)
+		{
+			rec = &node->ring[Emcy_history(node, j)];
+			fprintf(out, "%2.2x\t%.6f\t%4.4x\t%2.2x\t%2.2x%2.2x%2.2x%2.2x%2.2x\n", i, rec->timestamp / 1e9,
+					rec->code, rec->errorRegister,
+					rec->data[0], rec->data[1], rec->data[2], rec->data[3], rec->data[4]);
+		}
+	}
+	fprintf(out, "# node\tcode\tcount\tfirst_s\tlast_s\tmean_per_s\n");
+	for(i = 1 ; i <= MAX_NODES ; i++)
+	{
+		if (!Emcy_snapshot(i, node))
+			continue;
+		for(j = 0 ; j < node->codes ; j++)
+			fprintf(out, "%2.2x\t%4.4x\t%u\t%.6f\t%.6f\t%.3f\n", i, node->counters[j].code,
+					node->counters[j].count, node->counters[j].first / 1e9,
+					node->counters[j].last / 1e9, Emcy_mean_rate(&node->counters[j]));
+	}
+	fclose(out);
+	free(node);
+	return 0;
+}
@@ -0,0 +1,73 @@
+/*
+This file is part of CanFestival, a library implementing CanOpen Stack.
+
+Copyright (C): Edouard TISSERANT and Francis DUPIN
+
+See COPYING file for copyrights details.
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+
+
+#ifndef CANOPENSHELLEMCY_H
+#define CANOPENSHELLEMCY_H
+
+#include <stdio.h>
+
+#include "canfestival.h"
+#include "CANOpenShellSDO.h"
+
+#define EMCY_HISTORY 64		/* last EMCY kept per node, power of two */
+#define EMCY_CODES 32		/* distinct error codes counted per node */
+#define EMCY_RATE_WINDOW_MS 1000	/* recent rate: EMCY counted in the last full window */
+
+typedef struct {
+	UNS64 timestamp;	/* CLOCK_MONOTONIC, ns */
+	UNS16 code;
+	UNS8 errorRegister;
+	UNS8 data[5];		/* manufacturer specific */
+} Emcy_record;
+
+typedef struct {
+	UNS16 code;
+	UNS32 count;
+	UNS64 first;		/* ns */
+	UNS64 last;
+} Emcy_counter;
+
+typedef struct {
+	UNS32 total;		/* EMCY received, the ring holds the last EMCY_HISTORY */
+	UNS32 other;		/* EMCY whose code found no free counter */
+	UNS32 codes;		/* counters used */
+	UNS64 windowStart;	/* ns */
+	UNS32 window;		/* EMCY since windowStart */
+	UNS32 previous;		/* EMCY in the window before */
+	Emcy_counter counters[EMCY_CODES];
+	Emcy_record ring[EMCY_HISTORY];
+} Emcy_node;
+
+/* Called for every frame received, stack mutex held: a few stores into
+ * the ring and counters of the node, nothing else, whatever the rate */
+void Emcy_frame(const Message* m, UNS64 timestamp);
+
+/* Stack mutex held */
+void Emcy_clear(void);
+
+/* Stack mutex NOT held: the data of each node is copied under the mutex
+ * and written out after. nodeId 0 prints one line per node. */
+void Emcy_print(FILE* out, UNS8 nodeId);
+int Emcy_export(const char* path);
+
+#endif // CANOPENSHELLEMCY_H
@@ -0,0 +1,275 @@
+/*
+This file is part of CanFestival, a library implementing CanOpen Stack.
+
+Copyright (C): Edouard TISSERANT and Francis DUPIN
+
+See COPYING file for copyrights details.
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+
+
+#include "CANOpenShellHeartbeat.h"
+
+#define HEARTBEAT_NONE 0xFF
+
+Heartbeat_node Heartbeat_nodes[MAX_NODES + 1];
+
+static UNS8 Heartbeat_heap[MAX_NODES];	/* node ids, earliest deadline first */
+static int Heartbeat_size;
+static TIMER_HANDLE Heartbeat_timer = TIMER_NONE;
+static UNS64 Heartbeat_armed;		/* deadline the alarm is set for */
+static UNS64 Heartbeat_late;		/* ns, worst detection delay */
+static Heartbeat_event_t Heartbeat_event;
+static int Heartbeat_ready;
+
+static void Heartbeat_init(void)
+{
+	int i;
+
+	if (Heartbeat_ready)
+		return;
+	for(i = 0 ; i <= MAX_NODES ; i++)
+		Heartbeat_nodes[i].heap = HEARTBEAT_NONE;
+	Heartbeat_ready = 1;
+}
+
+static void Heartbeat_place(int pos, UNS8 nodeId)
+{
+	Heartbeat_heap[pos] = nodeId;
+	Heartbeat_nodes[nodeId].heap = pos;
+}
+
+static void Heartbeat_sift_up(int pos)
+{
+	UNS8 nodeId = Heartbeat_heap[pos];
+	UNS64 deadline = Heartbeat_nodes[nodeId].deadline;
+	int parent;
+
+	while (pos > 0)
+	{
+		parent = (pos - 1) / 2;
+		if (Heartbeat_nodes[Heartbeat_heap[parent]].deadline <= deadline)
+			break;
+		Heartbeat_place(pos, Heartbeat_heap[parent]);
+		pos = parent;
+	}
+	Heartbeat_place(pos, nodeId);
+}
+
+static void Heartbeat_sift_down(int pos)
+{
+	UNS8 nodeId = Heartbeat_heap[pos];
+	UNS64 deadline = Heartbeat_nodes[nodeId].deadline;
+	int child;
+
+	for(;;)
+	{
+		child = 2 * pos + 1;
+		if (child >= Heartbeat_size)
+			break;
+		if (child + 1 < Heartbeat_size &&
+				Heartbeat_nodes[Heartbeat_heap[child + 1]].deadline < Heartbeat_nodes[Heartbeat_heap[child]].deadline)
+			child++;
+		if (deadline <= Heartbeat_nodes[Heartbeat_heap[child]].deadline)
+			break;
+		Heartbeat_place(pos, Heartbeat_heap[child]);
+		pos = child;
+	}
+	Heartbeat_place(pos, nodeId);
+}
+
+static void Heartbeat_remove(UNS8 nodeId)
+{
+	int pos = Heartbeat_nodes[nodeId].heap;
+	UNS8 moved;
+
+	if (pos == HEARTBEAT_NONE)
+		return;
+	Heartbeat_nodes[nodeId].heap = HEARTBEAT_NONE;
+	if (--Heartbeat_size == pos)
+		return;
+	/* The last node takes the free place, then goes where it belongs */
+	moved = Heartbeat_heap[Heartbeat_size];
+	Heartbeat_place(pos, moved);
+	Heartbeat_sift_down(pos);
+	Heartbeat_sift_up(Heartbeat_nodes[moved].heap);
+}
+
+/* Set or move the deadline of a node */
+static void Heartbeat_schedule(UNS8 nodeId, UNS64 deadline)
+{
+	Heartbeat_node *node = &Heartbeat_nodes[nodeId];
+	UNS64 previous = node->deadline;
+
+	node->deadline = deadline;
+	if (node->heap == HEARTBEAT_NONE)
+	{
+		Heartbeat_place(Heartbeat_size++, nodeId);
+		Heartbeat_sift_up(node->heap);
+	}
+	else if (deadline > previous)
+		Heartbeat_sift_down(node->heap);
+	else
+		Heartbeat_sift_up(node->heap);
+}
+
+static void Heartbeat_alarm(CO_Data* d, UNS32 id);
+
+/* Keep the alarm on the earliest deadline */
+static void Heartbeat_arm(CO_Data* d)
+{
+	UNS64 deadline = Heartbeat_size ? Heartbeat_nodes[Heartbeat_heap[0]].deadline : 0;
+	UNS64 now;
+
+	if (deadline == Heartbeat_armed && (deadline == 0 || Heartbeat_timer != TIMER_NONE))
+		return;
+	Heartbeat_timer = DelAlarm(Heartbeat_timer);
+	Heartbeat_armed = deadline;
+	if (!deadline)
+		return;
+	now = SDO_now();
+	Heartbeat_timer = SetAlarm(d, 0, &Heartbeat_alarm, US_TO_TIMEVAL(deadline > now ? (deadline - now + 999) / 1000 : 0), 0);
+}
+
+static void Heartbeat_alarm(CO_Data* d, UNS32 id)
+{
+	UNS64 now = SDO_now();
+	Heartbeat_node *node;
+	UNS8 nodeId;
+
+	(void)id;
+	Heartbeat_timer = TIMER_NONE;
+	while (Heartbeat_size && Heartbeat_nodes[Heartbeat_heap[0]].deadline <= now)
+	{
+		nodeId = Heartbeat_heap[0];
+		node = &Heartbeat_nodes[nodeId];
+		Heartbeat_remove(nodeId);
+		if (now - node->deadline > Heartbeat_late)
+			Heartbeat_late = now - node->deadline;
+		node->state = Disconnected;
+		node->timeouts++;
+		if (Heartbeat_event)
+			Heartbeat_event(d, nodeId, 0);
+	}
+	Heartbeat_armed = 0;
+	Heartbeat_arm(d);
+}
+
+void Heartbeat_on_event(Heartbeat_event_t event)
+{
+	Heartbeat_event = event;
+}
+
+void Heartbeat_watch(CO_Data* d, UNS8 nodeId, UNS32 timeout)
+{
+	Heartbeat_node *node;
+
+	Heartbeat_init();
+	if (nodeId == 0 || nodeId > MAX_NODES)
+		return;
+	node = &Heartbeat_nodes[nodeId];
+	node->timeout = timeout;
+	if (timeout)
+		/* Give the node one full timeout from now */
+		Heartbeat_schedule(nodeId, SDO_now() + (UNS64)timeout * 1000);
+	else
+		Heartbeat_remove(nodeId);
+	Heartbeat_arm(d);
+}
+
+void Heartbeat_stop(CO_Data* d)
+{
+	int i;
+
+	Heartbeat_init();
+	for(i = 1 ; i <= MAX_NODES ; i++)
+	{
+		Heartbeat_nodes[i].timeout = 0;
+		Heartbeat_nodes[i].heap = HEARTBEAT_NONE;
+	}
+	Heartbeat_size = 0;
+	Heartbeat_late = 0;
+	Heartbeat_arm(d);
+}
+
+void Heartbeat_frame(CO_Data* d, const Message* m, UNS64 timestamp)
+{
+	Heartbeat_node *node;
+	UNS8 nodeId = m->cob_id - 0x700;
+	int back;
+
+	if (m->cob_id <= 0x700 || m->cob_id > 0x700 + MAX_NODES || m->rtr || m->len < 1)
+		return;
+	Heartbeat_init();
+	node = &Heartbeat_nodes[nodeId];
+	back = node->timeout && node->state == Disconnected;
+	if (node->last)
+		node->interval = (timestamp - node->last) / 1000;
+	node->last = timestamp;
+	node->state = m->data[0] & 0x7F;
+	node->count++;
+	if (!node->timeout)
+		return;
+	Heartbeat_schedule(nodeId, timestamp + (UNS64)node->timeout * 1000);
+	Heartbeat_arm(d);
+	if (back && Heartbeat_event)
+		Heartbeat_event(d, nodeId, 1);
+}
+
+static const char* Heartbeat_state(UNS8 state)
+{
+	switch(state)
+	{
+		case Initialisation: return "boot-up";
+		case Disconnected: return "lost";
+		case Stopped: return "stopped";
+		case Operational: return "operational";
+		case Pre_operational: return "pre-operational";
+	}
+	return "?";
+}
+
+void Heartbeat_print(FILE* out)
+{
+	UNS64 now = SDO_now();
+	Heartbeat_node *node;
+	int watched = 0;
+	int i;
+
+	Heartbeat_init();
+	fprintf(out, "Node  State            Count     Interval(ms)  Age(ms)   Timeout(ms)  Timeouts\n");
+	for(i = 1 ; i <= MAX_NODES ; i++)
+	{
+		node = &Heartbeat_nodes[i];
+		if (!node->count && !node->timeout)
+			continue;
+		fprintf(out, "%2.2x    %-15s  %-8u  %-12.3f  ", i,
+				node->count ? Heartbeat_state(node->state) : "-", node->count, node->interval / 1000.0);
+		if (node->count)
+			fprintf(out, "%-8.1f  ", (now - node->last) / 1e6);
+		else
+			fprintf(out, "-         ");
+		if (node->timeout)
+		{
+			fprintf(out, "%-11.3f  %u\n", node->timeout / 1000.0, node->timeouts);
+			watched++;
+		}
+		else
+			fprintf(out, "-            %u\n", node->timeouts);
+	}
+	fprintf(out, "%d nodes watched, timeouts detected at most %llu us late\n",
+			watched, (unsigned long long)Heartbeat_late / 1000);
+}
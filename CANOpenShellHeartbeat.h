@@ -0,0 +1,65 @@
+/*
+This file is part of CanFestival, a library implementing CanOpen Stack.
+
+Copyright (C): Edouard TISSERANT and Francis DUPIN
+
+See COPYING file for copyrights details.
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+
+
+#ifndef CANOPENSHELLHEARTBEAT_H
+#define CANOPENSHELLHEARTBEAT_H
+
+#include <stdio.h>
+
+#include "canfestival.h"
+#include "CANOpenShellSDO.h"
+
+/* What the monitor knows about one node, indexed by node id */
+typedef struct {
+	UNS64 last;		/* ns, CLOCK_MONOTONIC of the last heartbeat */
+	UNS64 deadline;		/* ns, last heartbeat + timeout while watched */
+	UNS32 timeout;		/* us, 0: not watched */
+	UNS32 interval;		/* us, between the last two heartbeats */
+	UNS32 count;
+	UNS32 timeouts;
+	UNS8 state;		/* NMT state of the last heartbeat, Disconnected after a timeout */
+	UNS8 heap;		/* position in the deadline heap, 0xFF when not in it */
+} Heartbeat_node;
+
+/* Called when a watched node times out (alive 0) or comes back, stack
+ * mutex held */
+typedef void (*Heartbeat_event_t)(CO_Data* d, UNS8 nodeId, int alive);
+
+extern Heartbeat_node Heartbeat_nodes[MAX_NODES + 1];
+
+void Heartbeat_on_event(Heartbeat_event_t event);
+
+/* Watch nodeId: a timeout event is raised when no heartbeat came for
+ * timeout us (0 stops watching the node). The earliest deadline is kept
+ * at the top of a heap and is the only alarm armed, so the timer thread
+ * does no work until a node is actually late. Stack mutex held. */
+void Heartbeat_watch(CO_Data* d, UNS8 nodeId, UNS32 timeout);
+void Heartbeat_stop(CO_Data* d);
+
+/* Called for every frame received, stack mutex held */
+void Heartbeat_frame(CO_Data* d, const Message* m, UNS64 timestamp);
+
+/* Live table of the nodes heard or watched, stack mutex held */
+void Heartbeat_print(FILE* out);
+
+#endif // CANOPENSHELLHEARTBEAT_H
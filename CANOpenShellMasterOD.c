@@ -2,6 +2,7 @@
 /* File generated by gen_cfile.py. Should not be modified. */
 
 #include "CANOpenShellMasterOD.h"
+#include "CANOpenShellODCompact.h"
 
 /**************************************************************************/
 /* Declaration of mapped variables                                        */
@@ -136,1655 +137,27 @@ $$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$
                        { RO, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1018_Serial_Number }
                      };
 
-/* index 0x1280 :   Client SDO 1 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1280 = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj1280_COB_ID_Client_to_Server_Transmit_SDO = 0x600;	/* 1536 */
-                    UNS32 CANOpenShellMasterOD_obj1280_COB_ID_Server_to_Client_Receive_SDO = 0x580;	/* 1408 */
-                    UNS8 CANOpenShellMasterOD_obj1280_Node_ID_of_the_SDO_Server = 0x0;	/* 0 */
-                    subindex CANOpenShellMasterOD_Index1280[] = 
+/* index 0x1280 - 0x12FE :   Client SDO 1 - 127 Parameters, entry i talks to node 1 + i
+ * (CANOpenShellODCompact.h). */
+                    sdo_client_parameter CANOpenShellMasterOD_obj1280[127] =
                      {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1280 },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1280_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1280_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1280_Node_ID_of_the_SDO_Server }
+                       SDO_REPEAT64(SDO_CLIENT_PARAMETER, 1, 0),
+                       SDO_REPEAT32(SDO_CLIENT_PARAMETER, 1, 64),
+                       SDO_REPEAT16(SDO_CLIENT_PARAMETER, 1, 96),
+                       SDO_REPEAT8(SDO_CLIENT_PARAMETER, 1, 112),
+                       SDO_REPEAT4(SDO_CLIENT_PARAMETER, 1, 120),
+                       SDO_REPEAT2(SDO_CLIENT_PARAMETER, 1, 124),
+                       SDO_REPEAT1(SDO_CLIENT_PARAMETER, 1, 126)
                      };
-
-/* index 0x1281 :   Client SDO 2 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1281 = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj1281_COB_ID_Client_to_Server_Transmit_SDO = 0x601;	/* 1537 */
-                    UNS32 CANOpenShellMasterOD_obj1281_COB_ID_Server_to_Client_Receive_SDO = 0x581;	/* 1409 */
-                    UNS8 CANOpenShellMasterOD_obj1281_Node_ID_of_the_SDO_Server = 0x1;	/* 1 */
-                    subindex CANOpenShellMasterOD_Index1281[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1281 },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1281_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1281_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1281_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x1282 :   Client SDO 3 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1282 = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj1282_COB_ID_Client_to_Server_Transmit_SDO = 0x602;	/* 1538 */
-                    UNS32 CANOpenShellMasterOD_obj1282_COB_ID_Server_to_Client_Receive_SDO = 0x582;	/* 1410 */
-                    UNS8 CANOpenShellMasterOD_obj1282_Node_ID_of_the_SDO_Server = 0x2;	/* 2 */
-                    subindex CANOpenShellMasterOD_Index1282[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1282 },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1282_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1282_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1282_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x1283 :   Client SDO 4 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1283 = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj1283_COB_ID_Client_to_Server_Transmit_SDO = 0x603;	/* 1539 */
-                    UNS32 CANOpenShellMasterOD_obj1283_COB_ID_Server_to_Client_Receive_SDO = 0x583;	/* 1411 */
-                    UNS8 CANOpenShellMasterOD_obj1283_Node_ID_of_the_SDO_Server = 0x3;	/* 3 */
-                    subindex CANOpenShellMasterOD_Index1283[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1283 },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1283_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1283_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1283_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x1284 :   Client SDO 5 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1284 = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj1284_COB_ID_Client_to_Server_Transmit_SDO = 0x604;	/* 1540 */
-                    UNS32 CANOpenShellMasterOD_obj1284_COB_ID_Server_to_Client_Receive_SDO = 0x584;	/* 1412 */
-                    UNS8 CANOpenShellMasterOD_obj1284_Node_ID_of_the_SDO_Server = 0x4;	/* 4 */
-                    subindex CANOpenShellMasterOD_Index1284[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1284 },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1284_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1284_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1284_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x1285 :   Client SDO 6 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1285 = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj1285_COB_ID_Client_to_Server_Transmit_SDO = 0x605;	/* 1541 */
-                    UNS32 CANOpenShellMasterOD_obj1285_COB_ID_Server_to_Client_Receive_SDO = 0x585;	/* 1413 */
-                    UNS8 CANOpenShellMasterOD_obj1285_Node_ID_of_the_SDO_Server = 0x5;	/* 5 */
-                    subindex CANOpenShellMasterOD_Index1285[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1285 },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1285_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1285_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1285_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x1286 :   Client SDO 7 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1286 = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj1286_COB_ID_Client_to_Server_Transmit_SDO = 0x606;	/* 1542 */
-                    UNS32 CANOpenShellMasterOD_obj1286_COB_ID_Server_to_Client_Receive_SDO = 0x586;	/* 1414 */
-                    UNS8 CANOpenShellMasterOD_obj1286_Node_ID_of_the_SDO_Server = 0x6;	/* 6 */
-                    subindex CANOpenShellMasterOD_Index1286[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1286 },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1286_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1286_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1286_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x1287 :   Client SDO 8 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1287 = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj1287_COB_ID_Client_to_Server_Transmit_SDO = 0x607;	/* 1543 */
-                    UNS32 CANOpenShellMasterOD_obj1287_COB_ID_Server_to_Client_Receive_SDO = 0x587;	/* 1415 */
-                    UNS8 CANOpenShellMasterOD_obj1287_Node_ID_of_the_SDO_Server = 0x7;	/* 7 */
-                    subindex CANOpenShellMasterOD_Index1287[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1287 },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1287_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1287_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1287_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x1288 :   Client SDO 9 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1288 = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj1288_COB_ID_Client_to_Server_Transmit_SDO = 0x608;	/* 1544 */
-                    UNS32 CANOpenShellMasterOD_obj1288_COB_ID_Server_to_Client_Receive_SDO = 0x588;	/* 1416 */
-                    UNS8 CANOpenShellMasterOD_obj1288_Node_ID_of_the_SDO_Server = 0x8;	/* 8 */
-                    subindex CANOpenShellMasterOD_Index1288[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1288 },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1288_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1288_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1288_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x1289 :   Client SDO 10 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1289 = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj1289_COB_ID_Client_to_Server_Transmit_SDO = 0x609;	/* 1545 */
-                    UNS32 CANOpenShellMasterOD_obj1289_COB_ID_Server_to_Client_Receive_SDO = 0x589;	/* 1417 */
-                    UNS8 CANOpenShellMasterOD_obj1289_Node_ID_of_the_SDO_Server = 0x9;	/* 9 */
-                    subindex CANOpenShellMasterOD_Index1289[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1289 },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1289_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1289_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1289_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x128A :   Client SDO 11 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj128A = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj128A_COB_ID_Client_to_Server_Transmit_SDO = 0x60A;	/* 1546 */
-                    UNS32 CANOpenShellMasterOD_obj128A_COB_ID_Server_to_Client_Receive_SDO = 0x58A;	/* 1418 */
-                    UNS8 CANOpenShellMasterOD_obj128A_Node_ID_of_the_SDO_Server = 0xA;	/* 10 */
-                    subindex CANOpenShellMasterOD_Index128A[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj128A },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj128A_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj128A_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj128A_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x128B :   Client SDO 12 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj128B = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj128B_COB_ID_Client_to_Server_Transmit_SDO = 0x60B;	/* 1547 */
-                    UNS32 CANOpenShellMasterOD_obj128B_COB_ID_Server_to_Client_Receive_SDO = 0x58B;	/* 1419 */
-                    UNS8 CANOpenShellMasterOD_obj128B_Node_ID_of_the_SDO_Server = 0xB;	/* 11 */
-                    subindex CANOpenShellMasterOD_Index128B[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj128B },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj128B_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj128B_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj128B_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x128C :   Client SDO 13 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj128C = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj128C_COB_ID_Client_to_Server_Transmit_SDO = 0x60C;	/* 1548 */
-                    UNS32 CANOpenShellMasterOD_obj128C_COB_ID_Server_to_Client_Receive_SDO = 0x58C;	/* 1420 */
-                    UNS8 CANOpenShellMasterOD_obj128C_Node_ID_of_the_SDO_Server = 0xC;	/* 12 */
-                    subindex CANOpenShellMasterOD_Index128C[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj128C },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj128C_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj128C_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj128C_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x128D :   Client SDO 14 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj128D = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj128D_COB_ID_Client_to_Server_Transmit_SDO = 0x60D;	/* 1549 */
-                    UNS32 CANOpenShellMasterOD_obj128D_COB_ID_Server_to_Client_Receive_SDO = 0x58D;	/* 1421 */
-                    UNS8 CANOpenShellMasterOD_obj128D_Node_ID_of_the_SDO_Server = 0xD;	/* 13 */
-                    subindex CANOpenShellMasterOD_Index128D[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj128D },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj128D_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj128D_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj128D_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x128E :   Client SDO 15 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj128E = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj128E_COB_ID_Client_to_Server_Transmit_SDO = 0x60E;	/* 1550 */
-                    UNS32 CANOpenShellMasterOD_obj128E_COB_ID_Server_to_Client_Receive_SDO = 0x58E;	/* 1422 */
-                    UNS8 CANOpenShellMasterOD_obj128E_Node_ID_of_the_SDO_Server = 0xE;	/* 14 */
-                    subindex CANOpenShellMasterOD_Index128E[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj128E },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj128E_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj128E_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj128E_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x128F :   Client SDO 16 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj128F = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj128F_COB_ID_Client_to_Server_Transmit_SDO = 0x60F;	/* 1551 */
-                    UNS32 CANOpenShellMasterOD_obj128F_COB_ID_Server_to_Client_Receive_SDO = 0x58F;	/* 1423 */
-                    UNS8 CANOpenShellMasterOD_obj128F_Node_ID_of_the_SDO_Server = 0xF;	/* 15 */
-                    subindex CANOpenShellMasterOD_Index128F[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj128F },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj128F_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj128F_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj128F_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x1290 :   Client SDO 17 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1290 = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj1290_COB_ID_Client_to_Server_Transmit_SDO = 0x610;	/* 1552 */
-                    UNS32 CANOpenShellMasterOD_obj1290_COB_ID_Server_to_Client_Receive_SDO = 0x590;	/* 1424 */
-                    UNS8 CANOpenShellMasterOD_obj1290_Node_ID_of_the_SDO_Server = 0x10;	/* 16 */
-                    subindex CANOpenShellMasterOD_Index1290[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1290 },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1290_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1290_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1290_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x1291 :   Client SDO 18 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1291 = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj1291_COB_ID_Client_to_Server_Transmit_SDO = 0x611;	/* 1553 */
-                    UNS32 CANOpenShellMasterOD_obj1291_COB_ID_Server_to_Client_Receive_SDO = 0x591;	/* 1425 */
-                    UNS8 CANOpenShellMasterOD_obj1291_Node_ID_of_the_SDO_Server = 0x11;	/* 17 */
-                    subindex CANOpenShellMasterOD_Index1291[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1291 },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1291_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1291_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1291_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x1292 :   Client SDO 19 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1292 = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj1292_COB_ID_Client_to_Server_Transmit_SDO = 0x612;	/* 1554 */
-                    UNS32 CANOpenShellMasterOD_obj1292_COB_ID_Server_to_Client_Receive_SDO = 0x592;	/* 1426 */
-                    UNS8 CANOpenShellMasterOD_obj1292_Node_ID_of_the_SDO_Server = 0x12;	/* 18 */
-                    subindex CANOpenShellMasterOD_Index1292[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1292 },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1292_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1292_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1292_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x1293 :   Client SDO 20 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1293 = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj1293_COB_ID_Client_to_Server_Transmit_SDO = 0x613;	/* 1555 */
-                    UNS32 CANOpenShellMasterOD_obj1293_COB_ID_Server_to_Client_Receive_SDO = 0x593;	/* 1427 */
-                    UNS8 CANOpenShellMasterOD_obj1293_Node_ID_of_the_SDO_Server = 0x13;	/* 19 */
-                    subindex CANOpenShellMasterOD_Index1293[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1293 },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1293_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1293_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1293_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x1294 :   Client SDO 21 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1294 = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj1294_COB_ID_Client_to_Server_Transmit_SDO = 0x614;	/* 1556 */
-                    UNS32 CANOpenShellMasterOD_obj1294_COB_ID_Server_to_Client_Receive_SDO = 0x594;	/* 1428 */
-                    UNS8 CANOpenShellMasterOD_obj1294_Node_ID_of_the_SDO_Server = 0x14;	/* 20 */
-                    subindex CANOpenShellMasterOD_Index1294[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1294 },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1294_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1294_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1294_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x1295 :   Client SDO 22 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1295 = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj1295_COB_ID_Client_to_Server_Transmit_SDO = 0x615;	/* 1557 */
-                    UNS32 CANOpenShellMasterOD_obj1295_COB_ID_Server_to_Client_Receive_SDO = 0x595;	/* 1429 */
-                    UNS8 CANOpenShellMasterOD_obj1295_Node_ID_of_the_SDO_Server = 0x15;	/* 21 */
-                    subindex CANOpenShellMasterOD_Index1295[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1295 },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1295_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1295_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1295_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x1296 :   Client SDO 23 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1296 = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj1296_COB_ID_Client_to_Server_Transmit_SDO = 0x616;	/* 1558 */
-                    UNS32 CANOpenShellMasterOD_obj1296_COB_ID_Server_to_Client_Receive_SDO = 0x596;	/* 1430 */
-                    UNS8 CANOpenShellMasterOD_obj1296_Node_ID_of_the_SDO_Server = 0x16;	/* 22 */
-                    subindex CANOpenShellMasterOD_Index1296[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1296 },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1296_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1296_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1296_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x1297 :   Client SDO 24 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1297 = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj1297_COB_ID_Client_to_Server_Transmit_SDO = 0x617;	/* 1559 */
-                    UNS32 CANOpenShellMasterOD_obj1297_COB_ID_Server_to_Client_Receive_SDO = 0x597;	/* 1431 */
-                    UNS8 CANOpenShellMasterOD_obj1297_Node_ID_of_the_SDO_Server = 0x17;	/* 23 */
-                    subindex CANOpenShellMasterOD_Index1297[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1297 },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1297_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1297_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1297_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x1298 :   Client SDO 25 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1298 = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj1298_COB_ID_Client_to_Server_Transmit_SDO = 0x618;	/* 1560 */
-                    UNS32 CANOpenShellMasterOD_obj1298_COB_ID_Server_to_Client_Receive_SDO = 0x598;	/* 1432 */
-                    UNS8 CANOpenShellMasterOD_obj1298_Node_ID_of_the_SDO_Server = 0x18;	/* 24 */
-                    subindex CANOpenShellMasterOD_Index1298[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1298 },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1298_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1298_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1298_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x1299 :   Client SDO 26 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1299 = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj1299_COB_ID_Client_to_Server_Transmit_SDO = 0x619;	/* 1561 */
-                    UNS32 CANOpenShellMasterOD_obj1299_COB_ID_Server_to_Client_Receive_SDO = 0x599;	/* 1433 */
-                    UNS8 CANOpenShellMasterOD_obj1299_Node_ID_of_the_SDO_Server = 0x19;	/* 25 */
-                    subindex CANOpenShellMasterOD_Index1299[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1299 },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1299_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1299_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1299_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x129A :   Client SDO 27 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj129A = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj129A_COB_ID_Client_to_Server_Transmit_SDO = 0x61A;	/* 1562 */
-                    UNS32 CANOpenShellMasterOD_obj129A_COB_ID_Server_to_Client_Receive_SDO = 0x59A;	/* 1434 */
-                    UNS8 CANOpenShellMasterOD_obj129A_Node_ID_of_the_SDO_Server = 0x1A;	/* 26 */
-                    subindex CANOpenShellMasterOD_Index129A[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj129A },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj129A_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj129A_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj129A_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x129B :   Client SDO 28 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj129B = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj129B_COB_ID_Client_to_Server_Transmit_SDO = 0x61B;	/* 1563 */
-                    UNS32 CANOpenShellMasterOD_obj129B_COB_ID_Server_to_Client_Receive_SDO = 0x59B;	/* 1435 */
-                    UNS8 CANOpenShellMasterOD_obj129B_Node_ID_of_the_SDO_Server = 0x1B;	/* 27 */
-                    subindex CANOpenShellMasterOD_Index129B[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj129B },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj129B_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj129B_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj129B_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x129C :   Client SDO 29 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj129C = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj129C_COB_ID_Client_to_Server_Transmit_SDO = 0x61C;	/* 1564 */
-                    UNS32 CANOpenShellMasterOD_obj129C_COB_ID_Server_to_Client_Receive_SDO = 0x59C;	/* 1436 */
-                    UNS8 CANOpenShellMasterOD_obj129C_Node_ID_of_the_SDO_Server = 0x1C;	/* 28 */
-                    subindex CANOpenShellMasterOD_Index129C[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj129C },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj129C_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj129C_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj129C_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x129D :   Client SDO 30 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj129D = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj129D_COB_ID_Client_to_Server_Transmit_SDO = 0x61D;	/* 1565 */
-                    UNS32 CANOpenShellMasterOD_obj129D_COB_ID_Server_to_Client_Receive_SDO = 0x59D;	/* 1437 */
-                    UNS8 CANOpenShellMasterOD_obj129D_Node_ID_of_the_SDO_Server = 0x1D;	/* 29 */
-                    subindex CANOpenShellMasterOD_Index129D[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj129D },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj129D_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj129D_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj129D_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x129E :   Client SDO 31 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj129E = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj129E_COB_ID_Client_to_Server_Transmit_SDO = 0x61E;	/* 1566 */
-                    UNS32 CANOpenShellMasterOD_obj129E_COB_ID_Server_to_Client_Receive_SDO = 0x59E;	/* 1438 */
-                    UNS8 CANOpenShellMasterOD_obj129E_Node_ID_of_the_SDO_Server = 0x1E;	/* 30 */
-                    subindex CANOpenShellMasterOD_Index129E[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj129E },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj129E_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj129E_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj129E_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x129F :   Client SDO 32 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj129F = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj129F_COB_ID_Client_to_Server_Transmit_SDO = 0x61F;	/* 1567 */
-                    UNS32 CANOpenShellMasterOD_obj129F_COB_ID_Server_to_Client_Receive_SDO = 0x59F;	/* 1439 */
-                    UNS8 CANOpenShellMasterOD_obj129F_Node_ID_of_the_SDO_Server = 0x1F;	/* 31 */
-                    subindex CANOpenShellMasterOD_Index129F[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj129F },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj129F_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj129F_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj129F_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12A0 :   Client SDO 33 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12A0 = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12A0_COB_ID_Client_to_Server_Transmit_SDO = 0x620;	/* 1568 */
-                    UNS32 CANOpenShellMasterOD_obj12A0_COB_ID_Server_to_Client_Receive_SDO = 0x5A0;	/* 1440 */
-                    UNS8 CANOpenShellMasterOD_obj12A0_Node_ID_of_the_SDO_Server = 0x20;	/* 32 */
-                    subindex CANOpenShellMasterOD_Index12A0[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12A0 },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12A0_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12A0_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12A0_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12A1 :   Client SDO 34 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12A1 = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12A1_COB_ID_Client_to_Server_Transmit_SDO = 0x621;	/* 1569 */
-                    UNS32 CANOpenShellMasterOD_obj12A1_COB_ID_Server_to_Client_Receive_SDO = 0x5A1;	/* 1441 */
-                    UNS8 CANOpenShellMasterOD_obj12A1_Node_ID_of_the_SDO_Server = 0x21;	/* 33 */
-                    subindex CANOpenShellMasterOD_Index12A1[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12A1 },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12A1_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12A1_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12A1_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12A2 :   Client SDO 35 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12A2 = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12A2_COB_ID_Client_to_Server_Transmit_SDO = 0x622;	/* 1570 */
-                    UNS32 CANOpenShellMasterOD_obj12A2_COB_ID_Server_to_Client_Receive_SDO = 0x5A2;	/* 1442 */
-                    UNS8 CANOpenShellMasterOD_obj12A2_Node_ID_of_the_SDO_Server = 0x22;	/* 34 */
-                    subindex CANOpenShellMasterOD_Index12A2[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12A2 },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12A2_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12A2_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12A2_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12A3 :   Client SDO 36 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12A3 = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12A3_COB_ID_Client_to_Server_Transmit_SDO = 0x623;	/* 1571 */
-                    UNS32 CANOpenShellMasterOD_obj12A3_COB_ID_Server_to_Client_Receive_SDO = 0x5A3;	/* 1443 */
-                    UNS8 CANOpenShellMasterOD_obj12A3_Node_ID_of_the_SDO_Server = 0x23;	/* 35 */
-                    subindex CANOpenShellMasterOD_Index12A3[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12A3 },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12A3_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12A3_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12A3_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12A4 :   Client SDO 37 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12A4 = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12A4_COB_ID_Client_to_Server_Transmit_SDO = 0x624;	/* 1572 */
-                    UNS32 CANOpenShellMasterOD_obj12A4_COB_ID_Server_to_Client_Receive_SDO = 0x5A4;	/* 1444 */
-                    UNS8 CANOpenShellMasterOD_obj12A4_Node_ID_of_the_SDO_Server = 0x24;	/* 36 */
-                    subindex CANOpenShellMasterOD_Index12A4[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12A4 },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12A4_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12A4_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12A4_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12A5 :   Client SDO 38 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12A5 = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12A5_COB_ID_Client_to_Server_Transmit_SDO = 0x625;	/* 1573 */
-                    UNS32 CANOpenShellMasterOD_obj12A5_COB_ID_Server_to_Client_Receive_SDO = 0x5A5;	/* 1445 */
-                    UNS8 CANOpenShellMasterOD_obj12A5_Node_ID_of_the_SDO_Server = 0x25;	/* 37 */
-                    subindex CANOpenShellMasterOD_Index12A5[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12A5 },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12A5_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12A5_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12A5_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12A6 :   Client SDO 39 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12A6 = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12A6_COB_ID_Client_to_Server_Transmit_SDO = 0x626;	/* 1574 */
-                    UNS32 CANOpenShellMasterOD_obj12A6_COB_ID_Server_to_Client_Receive_SDO = 0x5A6;	/* 1446 */
-                    UNS8 CANOpenShellMasterOD_obj12A6_Node_ID_of_the_SDO_Server = 0x26;	/* 38 */
-                    subindex CANOpenShellMasterOD_Index12A6[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12A6 },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12A6_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12A6_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12A6_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12A7 :   Client SDO 40 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12A7 = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12A7_COB_ID_Client_to_Server_Transmit_SDO = 0x627;	/* 1575 */
-                    UNS32 CANOpenShellMasterOD_obj12A7_COB_ID_Server_to_Client_Receive_SDO = 0x5A7;	/* 1447 */
-                    UNS8 CANOpenShellMasterOD_obj12A7_Node_ID_of_the_SDO_Server = 0x27;	/* 39 */
-                    subindex CANOpenShellMasterOD_Index12A7[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12A7 },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12A7_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12A7_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12A7_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12A8 :   Client SDO 41 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12A8 = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12A8_COB_ID_Client_to_Server_Transmit_SDO = 0x628;	/* 1576 */
-                    UNS32 CANOpenShellMasterOD_obj12A8_COB_ID_Server_to_Client_Receive_SDO = 0x5A8;	/* 1448 */
-                    UNS8 CANOpenShellMasterOD_obj12A8_Node_ID_of_the_SDO_Server = 0x28;	/* 40 */
-                    subindex CANOpenShellMasterOD_Index12A8[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12A8 },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12A8_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12A8_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12A8_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12A9 :   Client SDO 42 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12A9 = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12A9_COB_ID_Client_to_Server_Transmit_SDO = 0x629;	/* 1577 */
-                    UNS32 CANOpenShellMasterOD_obj12A9_COB_ID_Server_to_Client_Receive_SDO = 0x5A9;	/* 1449 */
-                    UNS8 CANOpenShellMasterOD_obj12A9_Node_ID_of_the_SDO_Server = 0x29;	/* 41 */
-                    subindex CANOpenShellMasterOD_Index12A9[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12A9 },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12A9_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12A9_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12A9_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12AA :   Client SDO 43 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12AA = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12AA_COB_ID_Client_to_Server_Transmit_SDO = 0x62A;	/* 1578 */
-                    UNS32 CANOpenShellMasterOD_obj12AA_COB_ID_Server_to_Client_Receive_SDO = 0x5AA;	/* 1450 */
-                    UNS8 CANOpenShellMasterOD_obj12AA_Node_ID_of_the_SDO_Server = 0x2A;	/* 42 */
-                    subindex CANOpenShellMasterOD_Index12AA[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12AA },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12AA_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12AA_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12AA_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12AB :   Client SDO 44 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12AB = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12AB_COB_ID_Client_to_Server_Transmit_SDO = 0x62B;	/* 1579 */
-                    UNS32 CANOpenShellMasterOD_obj12AB_COB_ID_Server_to_Client_Receive_SDO = 0x5AB;	/* 1451 */
-                    UNS8 CANOpenShellMasterOD_obj12AB_Node_ID_of_the_SDO_Server = 0x2B;	/* 43 */
-                    subindex CANOpenShellMasterOD_Index12AB[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12AB },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12AB_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12AB_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12AB_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12AC :   Client SDO 45 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12AC = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12AC_COB_ID_Client_to_Server_Transmit_SDO = 0x62C;	/* 1580 */
-                    UNS32 CANOpenShellMasterOD_obj12AC_COB_ID_Server_to_Client_Receive_SDO = 0x5AC;	/* 1452 */
-                    UNS8 CANOpenShellMasterOD_obj12AC_Node_ID_of_the_SDO_Server = 0x2C;	/* 44 */
-                    subindex CANOpenShellMasterOD_Index12AC[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12AC },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12AC_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12AC_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12AC_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12AD :   Client SDO 46 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12AD = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12AD_COB_ID_Client_to_Server_Transmit_SDO = 0x62D;	/* 1581 */
-                    UNS32 CANOpenShellMasterOD_obj12AD_COB_ID_Server_to_Client_Receive_SDO = 0x5AD;	/* 1453 */
-                    UNS8 CANOpenShellMasterOD_obj12AD_Node_ID_of_the_SDO_Server = 0x2D;	/* 45 */
-                    subindex CANOpenShellMasterOD_Index12AD[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12AD },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12AD_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12AD_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12AD_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12AE :   Client SDO 47 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12AE = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12AE_COB_ID_Client_to_Server_Transmit_SDO = 0x62E;	/* 1582 */
-                    UNS32 CANOpenShellMasterOD_obj12AE_COB_ID_Server_to_Client_Receive_SDO = 0x5AE;	/* 1454 */
-                    UNS8 CANOpenShellMasterOD_obj12AE_Node_ID_of_the_SDO_Server = 0x2E;	/* 46 */
-                    subindex CANOpenShellMasterOD_Index12AE[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12AE },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12AE_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12AE_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12AE_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12AF :   Client SDO 48 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12AF = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12AF_COB_ID_Client_to_Server_Transmit_SDO = 0x62F;	/* 1583 */
-                    UNS32 CANOpenShellMasterOD_obj12AF_COB_ID_Server_to_Client_Receive_SDO = 0x5AF;	/* 1455 */
-                    UNS8 CANOpenShellMasterOD_obj12AF_Node_ID_of_the_SDO_Server = 0x2F;	/* 47 */
-                    subindex CANOpenShellMasterOD_Index12AF[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12AF },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12AF_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12AF_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12AF_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12B0 :   Client SDO 49 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12B0 = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12B0_COB_ID_Client_to_Server_Transmit_SDO = 0x630;	/* 1584 */
-                    UNS32 CANOpenShellMasterOD_obj12B0_COB_ID_Server_to_Client_Receive_SDO = 0x5B0;	/* 1456 */
-                    UNS8 CANOpenShellMasterOD_obj12B0_Node_ID_of_the_SDO_Server = 0x30;	/* 48 */
-                    subindex CANOpenShellMasterOD_Index12B0[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12B0 },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12B0_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12B0_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12B0_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12B1 :   Client SDO 50 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12B1 = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12B1_COB_ID_Client_to_Server_Transmit_SDO = 0x631;	/* 1585 */
-                    UNS32 CANOpenShellMasterOD_obj12B1_COB_ID_Server_to_Client_Receive_SDO = 0x5B1;	/* 1457 */
-                    UNS8 CANOpenShellMasterOD_obj12B1_Node_ID_of_the_SDO_Server = 0x31;	/* 49 */
-                    subindex CANOpenShellMasterOD_Index12B1[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12B1 },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12B1_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12B1_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12B1_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12B2 :   Client SDO 51 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12B2 = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12B2_COB_ID_Client_to_Server_Transmit_SDO = 0x632;	/* 1586 */
-                    UNS32 CANOpenShellMasterOD_obj12B2_COB_ID_Server_to_Client_Receive_SDO = 0x5B2;	/* 1458 */
-                    UNS8 CANOpenShellMasterOD_obj12B2_Node_ID_of_the_SDO_Server = 0x32;	/* 50 */
-                    subindex CANOpenShellMasterOD_Index12B2[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12B2 },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12B2_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12B2_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12B2_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12B3 :   Client SDO 52 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12B3 = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12B3_COB_ID_Client_to_Server_Transmit_SDO = 0x633;	/* 1587 */
-                    UNS32 CANOpenShellMasterOD_obj12B3_COB_ID_Server_to_Client_Receive_SDO = 0x5B3;	/* 1459 */
-                    UNS8 CANOpenShellMasterOD_obj12B3_Node_ID_of_the_SDO_Server = 0x33;	/* 51 */
-                    subindex CANOpenShellMasterOD_Index12B3[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12B3 },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12B3_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12B3_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12B3_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12B4 :   Client SDO 53 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12B4 = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12B4_COB_ID_Client_to_Server_Transmit_SDO = 0x634;	/* 1588 */
-                    UNS32 CANOpenShellMasterOD_obj12B4_COB_ID_Server_to_Client_Receive_SDO = 0x5B4;	/* 1460 */
-                    UNS8 CANOpenShellMasterOD_obj12B4_Node_ID_of_the_SDO_Server = 0x34;	/* 52 */
-                    subindex CANOpenShellMasterOD_Index12B4[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12B4 },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12B4_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12B4_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12B4_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12B5 :   Client SDO 54 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12B5 = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12B5_COB_ID_Client_to_Server_Transmit_SDO = 0x635;	/* 1589 */
-                    UNS32 CANOpenShellMasterOD_obj12B5_COB_ID_Server_to_Client_Receive_SDO = 0x5B5;	/* 1461 */
-                    UNS8 CANOpenShellMasterOD_obj12B5_Node_ID_of_the_SDO_Server = 0x35;	/* 53 */
-                    subindex CANOpenShellMasterOD_Index12B5[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12B5 },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12B5_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12B5_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12B5_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12B6 :   Client SDO 55 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12B6 = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12B6_COB_ID_Client_to_Server_Transmit_SDO = 0x636;	/* 1590 */
-                    UNS32 CANOpenShellMasterOD_obj12B6_COB_ID_Server_to_Client_Receive_SDO = 0x5B6;	/* 1462 */
-                    UNS8 CANOpenShellMasterOD_obj12B6_Node_ID_of_the_SDO_Server = 0x36;	/* 54 */
-                    subindex CANOpenShellMasterOD_Index12B6[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12B6 },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12B6_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12B6_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12B6_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12B7 :   Client SDO 56 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12B7 = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12B7_COB_ID_Client_to_Server_Transmit_SDO = 0x637;	/* 1591 */
-                    UNS32 CANOpenShellMasterOD_obj12B7_COB_ID_Server_to_Client_Receive_SDO = 0x5B7;	/* 1463 */
-                    UNS8 CANOpenShellMasterOD_obj12B7_Node_ID_of_the_SDO_Server = 0x37;	/* 55 */
-                    subindex CANOpenShellMasterOD_Index12B7[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12B7 },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12B7_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12B7_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12B7_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12B8 :   Client SDO 57 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12B8 = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12B8_COB_ID_Client_to_Server_Transmit_SDO = 0x638;	/* 1592 */
-                    UNS32 CANOpenShellMasterOD_obj12B8_COB_ID_Server_to_Client_Receive_SDO = 0x5B8;	/* 1464 */
-                    UNS8 CANOpenShellMasterOD_obj12B8_Node_ID_of_the_SDO_Server = 0x38;	/* 56 */
-                    subindex CANOpenShellMasterOD_Index12B8[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12B8 },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12B8_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12B8_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12B8_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12B9 :   Client SDO 58 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12B9 = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12B9_COB_ID_Client_to_Server_Transmit_SDO = 0x639;	/* 1593 */
-                    UNS32 CANOpenShellMasterOD_obj12B9_COB_ID_Server_to_Client_Receive_SDO = 0x5B9;	/* 1465 */
-                    UNS8 CANOpenShellMasterOD_obj12B9_Node_ID_of_the_SDO_Server = 0x39;	/* 57 */
-                    subindex CANOpenShellMasterOD_Index12B9[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12B9 },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12B9_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12B9_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12B9_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12BA :   Client SDO 59 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12BA = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12BA_COB_ID_Client_to_Server_Transmit_SDO = 0x63A;	/* 1594 */
-                    UNS32 CANOpenShellMasterOD_obj12BA_COB_ID_Server_to_Client_Receive_SDO = 0x5BA;	/* 1466 */
-                    UNS8 CANOpenShellMasterOD_obj12BA_Node_ID_of_the_SDO_Server = 0x3A;	/* 58 */
-                    subindex CANOpenShellMasterOD_Index12BA[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12BA },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12BA_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12BA_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12BA_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12BB :   Client SDO 60 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12BB = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12BB_COB_ID_Client_to_Server_Transmit_SDO = 0x63B;	/* 1595 */
-                    UNS32 CANOpenShellMasterOD_obj12BB_COB_ID_Server_to_Client_Receive_SDO = 0x5BB;	/* 1467 */
-                    UNS8 CANOpenShellMasterOD_obj12BB_Node_ID_of_the_SDO_Server = 0x3B;	/* 59 */
-                    subindex CANOpenShellMasterOD_Index12BB[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12BB },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12BB_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12BB_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12BB_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12BC :   Client SDO 61 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12BC = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12BC_COB_ID_Client_to_Server_Transmit_SDO = 0x63C;	/* 1596 */
-                    UNS32 CANOpenShellMasterOD_obj12BC_COB_ID_Server_to_Client_Receive_SDO = 0x5BC;	/* 1468 */
-                    UNS8 CANOpenShellMasterOD_obj12BC_Node_ID_of_the_SDO_Server = 0x3C;	/* 60 */
-                    subindex CANOpenShellMasterOD_Index12BC[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12BC },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12BC_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12BC_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12BC_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12BD :   Client SDO 62 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12BD = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12BD_COB_ID_Client_to_Server_Transmit_SDO = 0x63D;	/* 1597 */
-                    UNS32 CANOpenShellMasterOD_obj12BD_COB_ID_Server_to_Client_Receive_SDO = 0x5BD;	/* 1469 */
-                    UNS8 CANOpenShellMasterOD_obj12BD_Node_ID_of_the_SDO_Server = 0x3D;	/* 61 */
-                    subindex CANOpenShellMasterOD_Index12BD[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12BD },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12BD_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12BD_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12BD_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12BE :   Client SDO 63 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12BE = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12BE_COB_ID_Client_to_Server_Transmit_SDO = 0x63E;	/* 1598 */
-                    UNS32 CANOpenShellMasterOD_obj12BE_COB_ID_Server_to_Client_Receive_SDO = 0x5BE;	/* 1470 */
-                    UNS8 CANOpenShellMasterOD_obj12BE_Node_ID_of_the_SDO_Server = 0x3E;	/* 62 */
-                    subindex CANOpenShellMasterOD_Index12BE[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12BE },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12BE_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12BE_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12BE_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12BF :   Client SDO 64 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12BF = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12BF_COB_ID_Client_to_Server_Transmit_SDO = 0x63F;	/* 1599 */
-                    UNS32 CANOpenShellMasterOD_obj12BF_COB_ID_Server_to_Client_Receive_SDO = 0x5BF;	/* 1471 */
-                    UNS8 CANOpenShellMasterOD_obj12BF_Node_ID_of_the_SDO_Server = 0x3F;	/* 63 */
-                    subindex CANOpenShellMasterOD_Index12BF[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12BF },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12BF_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12BF_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12BF_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12C0 :   Client SDO 65 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12C0 = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12C0_COB_ID_Client_to_Server_Transmit_SDO = 0x640;	/* 1600 */
-                    UNS32 CANOpenShellMasterOD_obj12C0_COB_ID_Server_to_Client_Receive_SDO = 0x5C0;	/* 1472 */
-                    UNS8 CANOpenShellMasterOD_obj12C0_Node_ID_of_the_SDO_Server = 0x40;	/* 64 */
-                    subindex CANOpenShellMasterOD_Index12C0[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12C0 },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12C0_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12C0_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12C0_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12C1 :   Client SDO 66 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12C1 = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12C1_COB_ID_Client_to_Server_Transmit_SDO = 0x641;	/* 1601 */
-                    UNS32 CANOpenShellMasterOD_obj12C1_COB_ID_Server_to_Client_Receive_SDO = 0x5C1;	/* 1473 */
-                    UNS8 CANOpenShellMasterOD_obj12C1_Node_ID_of_the_SDO_Server = 0x41;	/* 65 */
-                    subindex CANOpenShellMasterOD_Index12C1[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12C1 },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12C1_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12C1_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12C1_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12C2 :   Client SDO 67 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12C2 = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12C2_COB_ID_Client_to_Server_Transmit_SDO = 0x642;	/* 1602 */
-                    UNS32 CANOpenShellMasterOD_obj12C2_COB_ID_Server_to_Client_Receive_SDO = 0x5C2;	/* 1474 */
-                    UNS8 CANOpenShellMasterOD_obj12C2_Node_ID_of_the_SDO_Server = 0x42;	/* 66 */
-                    subindex CANOpenShellMasterOD_Index12C2[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12C2 },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12C2_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12C2_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12C2_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12C3 :   Client SDO 68 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12C3 = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12C3_COB_ID_Client_to_Server_Transmit_SDO = 0x643;	/* 1603 */
-                    UNS32 CANOpenShellMasterOD_obj12C3_COB_ID_Server_to_Client_Receive_SDO = 0x5C3;	/* 1475 */
-                    UNS8 CANOpenShellMasterOD_obj12C3_Node_ID_of_the_SDO_Server = 0x43;	/* 67 */
-                    subindex CANOpenShellMasterOD_Index12C3[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12C3 },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12C3_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12C3_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12C3_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12C4 :   Client SDO 69 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12C4 = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12C4_COB_ID_Client_to_Server_Transmit_SDO = 0x644;	/* 1604 */
-                    UNS32 CANOpenShellMasterOD_obj12C4_COB_ID_Server_to_Client_Receive_SDO = 0x5C4;	/* 1476 */
-                    UNS8 CANOpenShellMasterOD_obj12C4_Node_ID_of_the_SDO_Server = 0x44;	/* 68 */
-                    subindex CANOpenShellMasterOD_Index12C4[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12C4 },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12C4_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12C4_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12C4_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12C5 :   Client SDO 70 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12C5 = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12C5_COB_ID_Client_to_Server_Transmit_SDO = 0x645;	/* 1605 */
-                    UNS32 CANOpenShellMasterOD_obj12C5_COB_ID_Server_to_Client_Receive_SDO = 0x5C5;	/* 1477 */
-                    UNS8 CANOpenShellMasterOD_obj12C5_Node_ID_of_the_SDO_Server = 0x45;	/* 69 */
-                    subindex CANOpenShellMasterOD_Index12C5[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12C5 },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12C5_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12C5_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12C5_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12C6 :   Client SDO 71 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12C6 = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12C6_COB_ID_Client_to_Server_Transmit_SDO = 0x646;	/* 1606 */
-                    UNS32 CANOpenShellMasterOD_obj12C6_COB_ID_Server_to_Client_Receive_SDO = 0x5C6;	/* 1478 */
-                    UNS8 CANOpenShellMasterOD_obj12C6_Node_ID_of_the_SDO_Server = 0x46;	/* 70 */
-                    subindex CANOpenShellMasterOD_Index12C6[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12C6 },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12C6_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12C6_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12C6_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12C7 :   Client SDO 72 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12C7 = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12C7_COB_ID_Client_to_Server_Transmit_SDO = 0x647;	/* 1607 */
-                    UNS32 CANOpenShellMasterOD_obj12C7_COB_ID_Server_to_Client_Receive_SDO = 0x5C7;	/* 1479 */
-                    UNS8 CANOpenShellMasterOD_obj12C7_Node_ID_of_the_SDO_Server = 0x47;	/* 71 */
-                    subindex CANOpenShellMasterOD_Index12C7[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12C7 },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12C7_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12C7_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12C7_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12C8 :   Client SDO 73 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12C8 = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12C8_COB_ID_Client_to_Server_Transmit_SDO = 0x648;	/* 1608 */
-                    UNS32 CANOpenShellMasterOD_obj12C8_COB_ID_Server_to_Client_Receive_SDO = 0x5C8;	/* 1480 */
-                    UNS8 CANOpenShellMasterOD_obj12C8_Node_ID_of_the_SDO_Server = 0x48;	/* 72 */
-                    subindex CANOpenShellMasterOD_Index12C8[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12C8 },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12C8_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12C8_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12C8_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12C9 :   Client SDO 74 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12C9 = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12C9_COB_ID_Client_to_Server_Transmit_SDO = 0x649;	/* 1609 */
-                    UNS32 CANOpenShellMasterOD_obj12C9_COB_ID_Server_to_Client_Receive_SDO = 0x5C9;	/* 1481 */
-                    UNS8 CANOpenShellMasterOD_obj12C9_Node_ID_of_the_SDO_Server = 0x49;	/* 73 */
-                    subindex CANOpenShellMasterOD_Index12C9[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12C9 },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12C9_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12C9_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12C9_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12CA :   Client SDO 75 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12CA = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12CA_COB_ID_Client_to_Server_Transmit_SDO = 0x64A;	/* 1610 */
-                    UNS32 CANOpenShellMasterOD_obj12CA_COB_ID_Server_to_Client_Receive_SDO = 0x5CA;	/* 1482 */
-                    UNS8 CANOpenShellMasterOD_obj12CA_Node_ID_of_the_SDO_Server = 0x4A;	/* 74 */
-                    subindex CANOpenShellMasterOD_Index12CA[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12CA },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12CA_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12CA_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12CA_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12CB :   Client SDO 76 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12CB = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12CB_COB_ID_Client_to_Server_Transmit_SDO = 0x64B;	/* 1611 */
-                    UNS32 CANOpenShellMasterOD_obj12CB_COB_ID_Server_to_Client_Receive_SDO = 0x5CB;	/* 1483 */
-                    UNS8 CANOpenShellMasterOD_obj12CB_Node_ID_of_the_SDO_Server = 0x4B;	/* 75 */
-                    subindex CANOpenShellMasterOD_Index12CB[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12CB },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12CB_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12CB_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12CB_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12CC :   Client SDO 77 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12CC = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12CC_COB_ID_Client_to_Server_Transmit_SDO = 0x64C;	/* 1612 */
-                    UNS32 CANOpenShellMasterOD_obj12CC_COB_ID_Server_to_Client_Receive_SDO = 0x5CC;	/* 1484 */
-                    UNS8 CANOpenShellMasterOD_obj12CC_Node_ID_of_the_SDO_Server = 0x4C;	/* 76 */
-                    subindex CANOpenShellMasterOD_Index12CC[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12CC },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12CC_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12CC_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12CC_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12CD :   Client SDO 78 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12CD = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12CD_COB_ID_Client_to_Server_Transmit_SDO = 0x64D;	/* 1613 */
-                    UNS32 CANOpenShellMasterOD_obj12CD_COB_ID_Server_to_Client_Receive_SDO = 0x5CD;	/* 1485 */
-                    UNS8 CANOpenShellMasterOD_obj12CD_Node_ID_of_the_SDO_Server = 0x4D;	/* 77 */
-                    subindex CANOpenShellMasterOD_Index12CD[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12CD },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12CD_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12CD_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12CD_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12CE :   Client SDO 79 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12CE = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12CE_COB_ID_Client_to_Server_Transmit_SDO = 0x64E;	/* 1614 */
-                    UNS32 CANOpenShellMasterOD_obj12CE_COB_ID_Server_to_Client_Receive_SDO = 0x5CE;	/* 1486 */
-                    UNS8 CANOpenShellMasterOD_obj12CE_Node_ID_of_the_SDO_Server = 0x4E;	/* 78 */
-                    subindex CANOpenShellMasterOD_Index12CE[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12CE },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12CE_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12CE_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12CE_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12CF :   Client SDO 80 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12CF = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12CF_COB_ID_Client_to_Server_Transmit_SDO = 0x64F;	/* 1615 */
-                    UNS32 CANOpenShellMasterOD_obj12CF_COB_ID_Server_to_Client_Receive_SDO = 0x5CF;	/* 1487 */
-                    UNS8 CANOpenShellMasterOD_obj12CF_Node_ID_of_the_SDO_Server = 0x4F;	/* 79 */
-                    subindex CANOpenShellMasterOD_Index12CF[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12CF },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12CF_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12CF_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12CF_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12D0 :   Client SDO 81 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12D0 = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12D0_COB_ID_Client_to_Server_Transmit_SDO = 0x650;	/* 1616 */
-                    UNS32 CANOpenShellMasterOD_obj12D0_COB_ID_Server_to_Client_Receive_SDO = 0x5D0;	/* 1488 */
-                    UNS8 CANOpenShellMasterOD_obj12D0_Node_ID_of_the_SDO_Server = 0x50;	/* 80 */
-                    subindex CANOpenShellMasterOD_Index12D0[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12D0 },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12D0_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12D0_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12D0_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12D1 :   Client SDO 82 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12D1 = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12D1_COB_ID_Client_to_Server_Transmit_SDO = 0x651;	/* 1617 */
-                    UNS32 CANOpenShellMasterOD_obj12D1_COB_ID_Server_to_Client_Receive_SDO = 0x5D1;	/* 1489 */
-                    UNS8 CANOpenShellMasterOD_obj12D1_Node_ID_of_the_SDO_Server = 0x51;	/* 81 */
-                    subindex CANOpenShellMasterOD_Index12D1[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12D1 },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12D1_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12D1_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12D1_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12D2 :   Client SDO 83 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12D2 = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12D2_COB_ID_Client_to_Server_Transmit_SDO = 0x652;	/* 1618 */
-                    UNS32 CANOpenShellMasterOD_obj12D2_COB_ID_Server_to_Client_Receive_SDO = 0x5D2;	/* 1490 */
-                    UNS8 CANOpenShellMasterOD_obj12D2_Node_ID_of_the_SDO_Server = 0x52;	/* 82 */
-                    subindex CANOpenShellMasterOD_Index12D2[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12D2 },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12D2_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12D2_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12D2_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12D3 :   Client SDO 84 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12D3 = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12D3_COB_ID_Client_to_Server_Transmit_SDO = 0x653;	/* 1619 */
-                    UNS32 CANOpenShellMasterOD_obj12D3_COB_ID_Server_to_Client_Receive_SDO = 0x5D3;	/* 1491 */
-                    UNS8 CANOpenShellMasterOD_obj12D3_Node_ID_of_the_SDO_Server = 0x53;	/* 83 */
-                    subindex CANOpenShellMasterOD_Index12D3[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12D3 },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12D3_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12D3_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12D3_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12D4 :   Client SDO 85 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12D4 = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12D4_COB_ID_Client_to_Server_Transmit_SDO = 0x654;	/* 1620 */
-                    UNS32 CANOpenShellMasterOD_obj12D4_COB_ID_Server_to_Client_Receive_SDO = 0x5D4;	/* 1492 */
-                    UNS8 CANOpenShellMasterOD_obj12D4_Node_ID_of_the_SDO_Server = 0x54;	/* 84 */
-                    subindex CANOpenShellMasterOD_Index12D4[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12D4 },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12D4_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12D4_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12D4_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12D5 :   Client SDO 86 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12D5 = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12D5_COB_ID_Client_to_Server_Transmit_SDO = 0x655;	/* 1621 */
-                    UNS32 CANOpenShellMasterOD_obj12D5_COB_ID_Server_to_Client_Receive_SDO = 0x5D5;	/* 1493 */
-                    UNS8 CANOpenShellMasterOD_obj12D5_Node_ID_of_the_SDO_Server = 0x55;	/* 85 */
-                    subindex CANOpenShellMasterOD_Index12D5[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12D5 },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12D5_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12D5_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12D5_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12D6 :   Client SDO 87 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12D6 = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12D6_COB_ID_Client_to_Server_Transmit_SDO = 0x656;	/* 1622 */
-                    UNS32 CANOpenShellMasterOD_obj12D6_COB_ID_Server_to_Client_Receive_SDO = 0x5D6;	/* 1494 */
-                    UNS8 CANOpenShellMasterOD_obj12D6_Node_ID_of_the_SDO_Server = 0x56;	/* 86 */
-                    subindex CANOpenShellMasterOD_Index12D6[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12D6 },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12D6_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12D6_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12D6_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12D7 :   Client SDO 88 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12D7 = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12D7_COB_ID_Client_to_Server_Transmit_SDO = 0x657;	/* 1623 */
-                    UNS32 CANOpenShellMasterOD_obj12D7_COB_ID_Server_to_Client_Receive_SDO = 0x5D7;	/* 1495 */
-                    UNS8 CANOpenShellMasterOD_obj12D7_Node_ID_of_the_SDO_Server = 0x57;	/* 87 */
-                    subindex CANOpenShellMasterOD_Index12D7[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12D7 },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12D7_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12D7_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12D7_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12D8 :   Client SDO 89 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12D8 = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12D8_COB_ID_Client_to_Server_Transmit_SDO = 0x658;	/* 1624 */
-                    UNS32 CANOpenShellMasterOD_obj12D8_COB_ID_Server_to_Client_Receive_SDO = 0x5D8;	/* 1496 */
-                    UNS8 CANOpenShellMasterOD_obj12D8_Node_ID_of_the_SDO_Server = 0x58;	/* 88 */
-                    subindex CANOpenShellMasterOD_Index12D8[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12D8 },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12D8_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12D8_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12D8_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12D9 :   Client SDO 90 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12D9 = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12D9_COB_ID_Client_to_Server_Transmit_SDO = 0x659;	/* 1625 */
-                    UNS32 CANOpenShellMasterOD_obj12D9_COB_ID_Server_to_Client_Receive_SDO = 0x5D9;	/* 1497 */
-                    UNS8 CANOpenShellMasterOD_obj12D9_Node_ID_of_the_SDO_Server = 0x59;	/* 89 */
-                    subindex CANOpenShellMasterOD_Index12D9[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12D9 },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12D9_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12D9_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12D9_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12DA :   Client SDO 91 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12DA = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12DA_COB_ID_Client_to_Server_Transmit_SDO = 0x65A;	/* 1626 */
-                    UNS32 CANOpenShellMasterOD_obj12DA_COB_ID_Server_to_Client_Receive_SDO = 0x5DA;	/* 1498 */
-                    UNS8 CANOpenShellMasterOD_obj12DA_Node_ID_of_the_SDO_Server = 0x5A;	/* 90 */
-                    subindex CANOpenShellMasterOD_Index12DA[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12DA },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12DA_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12DA_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12DA_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12DB :   Client SDO 92 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12DB = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12DB_COB_ID_Client_to_Server_Transmit_SDO = 0x65B;	/* 1627 */
-                    UNS32 CANOpenShellMasterOD_obj12DB_COB_ID_Server_to_Client_Receive_SDO = 0x5DB;	/* 1499 */
-                    UNS8 CANOpenShellMasterOD_obj12DB_Node_ID_of_the_SDO_Server = 0x5B;	/* 91 */
-                    subindex CANOpenShellMasterOD_Index12DB[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12DB },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12DB_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12DB_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12DB_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12DC :   Client SDO 93 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12DC = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12DC_COB_ID_Client_to_Server_Transmit_SDO = 0x65C;	/* 1628 */
-                    UNS32 CANOpenShellMasterOD_obj12DC_COB_ID_Server_to_Client_Receive_SDO = 0x5DC;	/* 1500 */
-                    UNS8 CANOpenShellMasterOD_obj12DC_Node_ID_of_the_SDO_Server = 0x5C;	/* 92 */
-                    subindex CANOpenShellMasterOD_Index12DC[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12DC },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12DC_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12DC_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12DC_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12DD :   Client SDO 94 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12DD = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12DD_COB_ID_Client_to_Server_Transmit_SDO = 0x65D;	/* 1629 */
-                    UNS32 CANOpenShellMasterOD_obj12DD_COB_ID_Server_to_Client_Receive_SDO = 0x5DD;	/* 1501 */
-                    UNS8 CANOpenShellMasterOD_obj12DD_Node_ID_of_the_SDO_Server = 0x5D;	/* 93 */
-                    subindex CANOpenShellMasterOD_Index12DD[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12DD },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12DD_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12DD_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12DD_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12DE :   Client SDO 95 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12DE = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12DE_COB_ID_Client_to_Server_Transmit_SDO = 0x65E;	/* 1630 */
-                    UNS32 CANOpenShellMasterOD_obj12DE_COB_ID_Server_to_Client_Receive_SDO = 0x5DE;	/* 1502 */
-                    UNS8 CANOpenShellMasterOD_obj12DE_Node_ID_of_the_SDO_Server = 0x5E;	/* 94 */
-                    subindex CANOpenShellMasterOD_Index12DE[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12DE },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12DE_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12DE_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12DE_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12DF :   Client SDO 96 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12DF = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12DF_COB_ID_Client_to_Server_Transmit_SDO = 0x65F;	/* 1631 */
-                    UNS32 CANOpenShellMasterOD_obj12DF_COB_ID_Server_to_Client_Receive_SDO = 0x5DF;	/* 1503 */
-                    UNS8 CANOpenShellMasterOD_obj12DF_Node_ID_of_the_SDO_Server = 0x5F;	/* 95 */
-                    subindex CANOpenShellMasterOD_Index12DF[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12DF },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12DF_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12DF_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12DF_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12E0 :   Client SDO 97 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12E0 = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12E0_COB_ID_Client_to_Server_Transmit_SDO = 0x660;	/* 1632 */
-                    UNS32 CANOpenShellMasterOD_obj12E0_COB_ID_Server_to_Client_Receive_SDO = 0x5E0;	/* 1504 */
-                    UNS8 CANOpenShellMasterOD_obj12E0_Node_ID_of_the_SDO_Server = 0x60;	/* 96 */
-                    subindex CANOpenShellMasterOD_Index12E0[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12E0 },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12E0_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12E0_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12E0_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12E1 :   Client SDO 98 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12E1 = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12E1_COB_ID_Client_to_Server_Transmit_SDO = 0x661;	/* 1633 */
-                    UNS32 CANOpenShellMasterOD_obj12E1_COB_ID_Server_to_Client_Receive_SDO = 0x5E1;	/* 1505 */
-                    UNS8 CANOpenShellMasterOD_obj12E1_Node_ID_of_the_SDO_Server = 0x61;	/* 97 */
-                    subindex CANOpenShellMasterOD_Index12E1[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12E1 },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12E1_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12E1_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12E1_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12E2 :   Client SDO 99 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12E2 = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12E2_COB_ID_Client_to_Server_Transmit_SDO = 0x662;	/* 1634 */
-                    UNS32 CANOpenShellMasterOD_obj12E2_COB_ID_Server_to_Client_Receive_SDO = 0x5E2;	/* 1506 */
-                    UNS8 CANOpenShellMasterOD_obj12E2_Node_ID_of_the_SDO_Server = 0x62;	/* 98 */
-                    subindex CANOpenShellMasterOD_Index12E2[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12E2 },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12E2_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12E2_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12E2_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12E3 :   Client SDO 100 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12E3 = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12E3_COB_ID_Client_to_Server_Transmit_SDO = 0x663;	/* 1635 */
-                    UNS32 CANOpenShellMasterOD_obj12E3_COB_ID_Server_to_Client_Receive_SDO = 0x5E3;	/* 1507 */
-                    UNS8 CANOpenShellMasterOD_obj12E3_Node_ID_of_the_SDO_Server = 0x63;	/* 99 */
-                    subindex CANOpenShellMasterOD_Index12E3[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12E3 },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12E3_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12E3_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12E3_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12E4 :   Client SDO 101 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12E4 = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12E4_COB_ID_Client_to_Server_Transmit_SDO = 0x664;	/* 1636 */
-                    UNS32 CANOpenShellMasterOD_obj12E4_COB_ID_Server_to_Client_Receive_SDO = 0x5E4;	/* 1508 */
-                    UNS8 CANOpenShellMasterOD_obj12E4_Node_ID_of_the_SDO_Server = 0x64;	/* 100 */
-                    subindex CANOpenShellMasterOD_Index12E4[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12E4 },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12E4_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12E4_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12E4_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12E5 :   Client SDO 102 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12E5 = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12E5_COB_ID_Client_to_Server_Transmit_SDO = 0x665;	/* 1637 */
-                    UNS32 CANOpenShellMasterOD_obj12E5_COB_ID_Server_to_Client_Receive_SDO = 0x5E5;	/* 1509 */
-                    UNS8 CANOpenShellMasterOD_obj12E5_Node_ID_of_the_SDO_Server = 0x65;	/* 101 */
-                    subindex CANOpenShellMasterOD_Index12E5[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12E5 },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12E5_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12E5_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12E5_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12E6 :   Client SDO 103 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12E6 = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12E6_COB_ID_Client_to_Server_Transmit_SDO = 0x666;	/* 1638 */
-                    UNS32 CANOpenShellMasterOD_obj12E6_COB_ID_Server_to_Client_Receive_SDO = 0x5E6;	/* 1510 */
-                    UNS8 CANOpenShellMasterOD_obj12E6_Node_ID_of_the_SDO_Server = 0x66;	/* 102 */
-                    subindex CANOpenShellMasterOD_Index12E6[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12E6 },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12E6_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12E6_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12E6_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12E7 :   Client SDO 104 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12E7 = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12E7_COB_ID_Client_to_Server_Transmit_SDO = 0x667;	/* 1639 */
-                    UNS32 CANOpenShellMasterOD_obj12E7_COB_ID_Server_to_Client_Receive_SDO = 0x5E7;	/* 1511 */
-                    UNS8 CANOpenShellMasterOD_obj12E7_Node_ID_of_the_SDO_Server = 0x67;	/* 103 */
-                    subindex CANOpenShellMasterOD_Index12E7[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12E7 },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12E7_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12E7_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12E7_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12E8 :   Client SDO 105 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12E8 = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12E8_COB_ID_Client_to_Server_Transmit_SDO = 0x668;	/* 1640 */
-                    UNS32 CANOpenShellMasterOD_obj12E8_COB_ID_Server_to_Client_Receive_SDO = 0x5E8;	/* 1512 */
-                    UNS8 CANOpenShellMasterOD_obj12E8_Node_ID_of_the_SDO_Server = 0x68;	/* 104 */
-                    subindex CANOpenShellMasterOD_Index12E8[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12E8 },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12E8_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12E8_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12E8_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12E9 :   Client SDO 106 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12E9 = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12E9_COB_ID_Client_to_Server_Transmit_SDO = 0x669;	/* 1641 */
-                    UNS32 CANOpenShellMasterOD_obj12E9_COB_ID_Server_to_Client_Receive_SDO = 0x5E9;	/* 1513 */
-                    UNS8 CANOpenShellMasterOD_obj12E9_Node_ID_of_the_SDO_Server = 0x69;	/* 105 */
-                    subindex CANOpenShellMasterOD_Index12E9[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12E9 },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12E9_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12E9_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12E9_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12EA :   Client SDO 107 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12EA = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12EA_COB_ID_Client_to_Server_Transmit_SDO = 0x66A;	/* 1642 */
-                    UNS32 CANOpenShellMasterOD_obj12EA_COB_ID_Server_to_Client_Receive_SDO = 0x5EA;	/* 1514 */
-                    UNS8 CANOpenShellMasterOD_obj12EA_Node_ID_of_the_SDO_Server = 0x6A;	/* 106 */
-                    subindex CANOpenShellMasterOD_Index12EA[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12EA },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12EA_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12EA_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12EA_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12EB :   Client SDO 108 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12EB = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12EB_COB_ID_Client_to_Server_Transmit_SDO = 0x66B;	/* 1643 */
-                    UNS32 CANOpenShellMasterOD_obj12EB_COB_ID_Server_to_Client_Receive_SDO = 0x5EB;	/* 1515 */
-                    UNS8 CANOpenShellMasterOD_obj12EB_Node_ID_of_the_SDO_Server = 0x6B;	/* 107 */
-                    subindex CANOpenShellMasterOD_Index12EB[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12EB },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12EB_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12EB_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12EB_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12EC :   Client SDO 109 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12EC = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12EC_COB_ID_Client_to_Server_Transmit_SDO = 0x66C;	/* 1644 */
-                    UNS32 CANOpenShellMasterOD_obj12EC_COB_ID_Server_to_Client_Receive_SDO = 0x5EC;	/* 1516 */
-                    UNS8 CANOpenShellMasterOD_obj12EC_Node_ID_of_the_SDO_Server = 0x6C;	/* 108 */
-                    subindex CANOpenShellMasterOD_Index12EC[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12EC },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12EC_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12EC_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12EC_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12ED :   Client SDO 110 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12ED = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12ED_COB_ID_Client_to_Server_Transmit_SDO = 0x66D;	/* 1645 */
-                    UNS32 CANOpenShellMasterOD_obj12ED_COB_ID_Server_to_Client_Receive_SDO = 0x5ED;	/* 1517 */
-                    UNS8 CANOpenShellMasterOD_obj12ED_Node_ID_of_the_SDO_Server = 0x6D;	/* 109 */
-                    subindex CANOpenShellMasterOD_Index12ED[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12ED },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12ED_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12ED_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12ED_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12EE :   Client SDO 111 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12EE = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12EE_COB_ID_Client_to_Server_Transmit_SDO = 0x66E;	/* 1646 */
-                    UNS32 CANOpenShellMasterOD_obj12EE_COB_ID_Server_to_Client_Receive_SDO = 0x5EE;	/* 1518 */
-                    UNS8 CANOpenShellMasterOD_obj12EE_Node_ID_of_the_SDO_Server = 0x6E;	/* 110 */
-                    subindex CANOpenShellMasterOD_Index12EE[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12EE },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12EE_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12EE_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12EE_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12EF :   Client SDO 112 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12EF = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12EF_COB_ID_Client_to_Server_Transmit_SDO = 0x66F;	/* 1647 */
-                    UNS32 CANOpenShellMasterOD_obj12EF_COB_ID_Server_to_Client_Receive_SDO = 0x5EF;	/* 1519 */
-                    UNS8 CANOpenShellMasterOD_obj12EF_Node_ID_of_the_SDO_Server = 0x6F;	/* 111 */
-                    subindex CANOpenShellMasterOD_Index12EF[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12EF },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12EF_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12EF_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12EF_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12F0 :   Client SDO 113 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12F0 = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12F0_COB_ID_Client_to_Server_Transmit_SDO = 0x670;	/* 1648 */
-                    UNS32 CANOpenShellMasterOD_obj12F0_COB_ID_Server_to_Client_Receive_SDO = 0x5F0;	/* 1520 */
-                    UNS8 CANOpenShellMasterOD_obj12F0_Node_ID_of_the_SDO_Server = 0x70;	/* 112 */
-                    subindex CANOpenShellMasterOD_Index12F0[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12F0 },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12F0_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12F0_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12F0_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12F1 :   Client SDO 114 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12F1 = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12F1_COB_ID_Client_to_Server_Transmit_SDO = 0x671;	/* 1649 */
-                    UNS32 CANOpenShellMasterOD_obj12F1_COB_ID_Server_to_Client_Receive_SDO = 0x5F1;	/* 1521 */
-                    UNS8 CANOpenShellMasterOD_obj12F1_Node_ID_of_the_SDO_Server = 0x71;	/* 113 */
-                    subindex CANOpenShellMasterOD_Index12F1[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12F1 },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12F1_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12F1_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12F1_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12F2 :   Client SDO 115 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12F2 = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12F2_COB_ID_Client_to_Server_Transmit_SDO = 0x672;	/* 1650 */
-                    UNS32 CANOpenShellMasterOD_obj12F2_COB_ID_Server_to_Client_Receive_SDO = 0x5F2;	/* 1522 */
-                    UNS8 CANOpenShellMasterOD_obj12F2_Node_ID_of_the_SDO_Server = 0x72;	/* 114 */
-                    subindex CANOpenShellMasterOD_Index12F2[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12F2 },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12F2_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12F2_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12F2_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12F3 :   Client SDO 116 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12F3 = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12F3_COB_ID_Client_to_Server_Transmit_SDO = 0x673;	/* 1651 */
-                    UNS32 CANOpenShellMasterOD_obj12F3_COB_ID_Server_to_Client_Receive_SDO = 0x5F3;	/* 1523 */
-                    UNS8 CANOpenShellMasterOD_obj12F3_Node_ID_of_the_SDO_Server = 0x73;	/* 115 */
-                    subindex CANOpenShellMasterOD_Index12F3[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12F3 },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12F3_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12F3_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12F3_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12F4 :   Client SDO 117 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12F4 = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12F4_COB_ID_Client_to_Server_Transmit_SDO = 0x674;	/* 1652 */
-                    UNS32 CANOpenShellMasterOD_obj12F4_COB_ID_Server_to_Client_Receive_SDO = 0x5F4;	/* 1524 */
-                    UNS8 CANOpenShellMasterOD_obj12F4_Node_ID_of_the_SDO_Server = 0x74;	/* 116 */
-                    subindex CANOpenShellMasterOD_Index12F4[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12F4 },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12F4_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12F4_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12F4_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12F5 :   Client SDO 118 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12F5 = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12F5_COB_ID_Client_to_Server_Transmit_SDO = 0x675;	/* 1653 */
-                    UNS32 CANOpenShellMasterOD_obj12F5_COB_ID_Server_to_Client_Receive_SDO = 0x5F5;	/* 1525 */
-                    UNS8 CANOpenShellMasterOD_obj12F5_Node_ID_of_the_SDO_Server = 0x75;	/* 117 */
-                    subindex CANOpenShellMasterOD_Index12F5[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12F5 },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12F5_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12F5_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12F5_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12F6 :   Client SDO 119 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12F6 = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12F6_COB_ID_Client_to_Server_Transmit_SDO = 0x676;	/* 1654 */
-                    UNS32 CANOpenShellMasterOD_obj12F6_COB_ID_Server_to_Client_Receive_SDO = 0x5F6;	/* 1526 */
-                    UNS8 CANOpenShellMasterOD_obj12F6_Node_ID_of_the_SDO_Server = 0x76;	/* 118 */
-                    subindex CANOpenShellMasterOD_Index12F6[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12F6 },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12F6_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12F6_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12F6_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12F7 :   Client SDO 120 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12F7 = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12F7_COB_ID_Client_to_Server_Transmit_SDO = 0x677;	/* 1655 */
-                    UNS32 CANOpenShellMasterOD_obj12F7_COB_ID_Server_to_Client_Receive_SDO = 0x5F7;	/* 1527 */
-                    UNS8 CANOpenShellMasterOD_obj12F7_Node_ID_of_the_SDO_Server = 0x77;	/* 119 */
-                    subindex CANOpenShellMasterOD_Index12F7[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12F7 },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12F7_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12F7_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12F7_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12F8 :   Client SDO 121 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12F8 = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12F8_COB_ID_Client_to_Server_Transmit_SDO = 0x678;	/* 1656 */
-                    UNS32 CANOpenShellMasterOD_obj12F8_COB_ID_Server_to_Client_Receive_SDO = 0x5F8;	/* 1528 */
-                    UNS8 CANOpenShellMasterOD_obj12F8_Node_ID_of_the_SDO_Server = 0x78;	/* 120 */
-                    subindex CANOpenShellMasterOD_Index12F8[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12F8 },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12F8_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12F8_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12F8_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12F9 :   Client SDO 122 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12F9 = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12F9_COB_ID_Client_to_Server_Transmit_SDO = 0x679;	/* 1657 */
-                    UNS32 CANOpenShellMasterOD_obj12F9_COB_ID_Server_to_Client_Receive_SDO = 0x5F9;	/* 1529 */
-                    UNS8 CANOpenShellMasterOD_obj12F9_Node_ID_of_the_SDO_Server = 0x79;	/* 121 */
-                    subindex CANOpenShellMasterOD_Index12F9[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12F9 },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12F9_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12F9_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12F9_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12FA :   Client SDO 123 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12FA = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12FA_COB_ID_Client_to_Server_Transmit_SDO = 0x67A;	/* 1658 */
-                    UNS32 CANOpenShellMasterOD_obj12FA_COB_ID_Server_to_Client_Receive_SDO = 0x5FA;	/* 1530 */
-                    UNS8 CANOpenShellMasterOD_obj12FA_Node_ID_of_the_SDO_Server = 0x7A;	/* 122 */
-                    subindex CANOpenShellMasterOD_Index12FA[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12FA },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12FA_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12FA_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12FA_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12FB :   Client SDO 124 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12FB = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12FB_COB_ID_Client_to_Server_Transmit_SDO = 0x67B;	/* 1659 */
-                    UNS32 CANOpenShellMasterOD_obj12FB_COB_ID_Server_to_Client_Receive_SDO = 0x5FB;	/* 1531 */
-                    UNS8 CANOpenShellMasterOD_obj12FB_Node_ID_of_the_SDO_Server = 0x7B;	/* 123 */
-                    subindex CANOpenShellMasterOD_Index12FB[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12FB },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12FB_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12FB_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12FB_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12FC :   Client SDO 125 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12FC = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12FC_COB_ID_Client_to_Server_Transmit_SDO = 0x67C;	/* 1660 */
-                    UNS32 CANOpenShellMasterOD_obj12FC_COB_ID_Server_to_Client_Receive_SDO = 0x5FC;	/* 1532 */
-                    UNS8 CANOpenShellMasterOD_obj12FC_Node_ID_of_the_SDO_Server = 0x7C;	/* 124 */
-                    subindex CANOpenShellMasterOD_Index12FC[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12FC },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12FC_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12FC_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12FC_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12FD :   Client SDO 126 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12FD = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12FD_COB_ID_Client_to_Server_Transmit_SDO = 0x67D;	/* 1661 */
-                    UNS32 CANOpenShellMasterOD_obj12FD_COB_ID_Server_to_Client_Receive_SDO = 0x5FD;	/* 1533 */
-                    UNS8 CANOpenShellMasterOD_obj12FD_Node_ID_of_the_SDO_Server = 0x7D;	/* 125 */
-                    subindex CANOpenShellMasterOD_Index12FD[] = 
-                     {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12FD },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12FD_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12FD_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12FD_Node_ID_of_the_SDO_Server }
-                     };
-
-/* index 0x12FE :   Client SDO 127 Parameter. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj12FE = 3; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj12FE_COB_ID_Client_to_Server_Transmit_SDO = 0x67E;	/* 1662 */
-                    UNS32 CANOpenShellMasterOD_obj12FE_COB_ID_Server_to_Client_Receive_SDO = 0x5FE;	/* 1534 */
-                    UNS8 CANOpenShellMasterOD_obj12FE_Node_ID_of_the_SDO_Server = 0x7E;	/* 126 */
-                    subindex CANOpenShellMasterOD_Index12FE[] = 
+                    subindex CANOpenShellMasterOD_Index1280[127][4] =
                      {
-                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj12FE },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12FE_COB_ID_Client_to_Server_Transmit_SDO },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj12FE_COB_ID_Server_to_Client_Receive_SDO },
-                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj12FE_Node_ID_of_the_SDO_Server }
+                       SDO_REPEAT64(SDO_CLIENT_SUBINDEX, CANOpenShellMasterOD_obj1280, 0),
+                       SDO_REPEAT32(SDO_CLIENT_SUBINDEX, CANOpenShellMasterOD_obj1280, 64),
+                       SDO_REPEAT16(SDO_CLIENT_SUBINDEX, CANOpenShellMasterOD_obj1280, 96),
+                       SDO_REPEAT8(SDO_CLIENT_SUBINDEX, CANOpenShellMasterOD_obj1280, 112),
+                       SDO_REPEAT4(SDO_CLIENT_SUBINDEX, CANOpenShellMasterOD_obj1280, 120),
+                       SDO_REPEAT2(SDO_CLIENT_SUBINDEX, CANOpenShellMasterOD_obj1280, 124),
+                       SDO_REPEAT1(SDO_CLIENT_SUBINDEX, CANOpenShellMasterOD_obj1280, 126)
                      };
 
 /* index 0x1400 :   Receive PDO 1 Parameter. */
@@ -1975,133 +348,13 @@ const indextable CANOpenShellMasterOD_objdict[] =
   { (subindex*)CANOpenShellMasterOD_Index1006,sizeof(CANOpenShellMasterOD_Index1006)/sizeof(CANOpenShellMasterOD_Index1006[0]), 0x1006},
   { (subindex*)CANOpenShellMasterOD_Index1017,sizeof(CANOpenShellMasterOD_Index1017)/sizeof(CANOpenShellMasterOD_Index1017[0]), 0x1017},
   { (subindex*)CANOpenShellMasterOD_Index1018,sizeof(CANOpenShellMasterOD_Index1018)/sizeof(CANOpenShellMasterOD_Index1018[0]), 0x1018},
-  { (subindex*)CANOpenShellMasterOD_Index1280,sizeof(CANOpenShellMasterOD_Index1280)/sizeof(CANOpenShellMasterOD_Index1280[0]), 0x1280},
-  { (subindex*)CANOpenShellMasterOD_Index1281,sizeof(CANOpenShellMasterOD_Index1281)/sizeof(CANOpenShellMasterOD_Index1281[0]), 0x1281},
-  { (subindex*)CANOpenShellMasterOD_Index1282,sizeof(CANOpenShellMasterOD_Index1282)/sizeof(CANOpenShellMasterOD_Index1282[0]), 0x1282},
-  { (subindex*)CANOpenShellMasterOD_Index1283,sizeof(CANOpenShellMasterOD_Index1283)/sizeof(CANOpenShellMasterOD_Index1283[0]), 0x1283},
-  { (subindex*)CANOpenShellMasterOD_Index1284,sizeof(CANOpenShellMasterOD_Index1284)/sizeof(CANOpenShellMasterOD_Index1284[0]), 0x1284},
-  { (subindex*)CANOpenShellMasterOD_Index1285,sizeof(CANOpenShellMasterOD_Index1285)/sizeof(CANOpenShellMasterOD_Index1285[0]), 0x1285},
-  { (subindex*)CANOpenShellMasterOD_Index1286,sizeof(CANOpenShellMasterOD_Index1286)/sizeof(CANOpenShellMasterOD_Index1286[0]), 0x1286},
-  { (subindex*)CANOpenShellMasterOD_Index1287,sizeof(CANOpenShellMasterOD_Index1287)/sizeof(CANOpenShellMasterOD_Index1287[0]), 0x1287},
-  { (subindex*)CANOpenShellMasterOD_Index1288,sizeof(CANOpenShellMasterOD_Index1288)/sizeof(CANOpenShellMasterOD_Index1288[0]), 0x1288},
-  { (subindex*)CANOpenShellMasterOD_Index1289,sizeof(CANOpenShellMasterOD_Index1289)/sizeof(CANOpenShellMasterOD_Index1289[0]), 0x1289},
-  { (subindex*)CANOpenShellMasterOD_Index128A,sizeof(CANOpenShellMasterOD_Index128A)/sizeof(CANOpenShellMasterOD_Index128A[0]), 0x128A},
-  { (subindex*)CANOpenShellMasterOD_Index128B,sizeof(CANOpenShellMasterOD_Index128B)/sizeof(CANOpenShellMasterOD_Index128B[0]), 0x128B},
-  { (subindex*)CANOpenShellMasterOD_Index128C,sizeof(CANOpenShellMasterOD_Index128C)/sizeof(CANOpenShellMasterOD_Index128C[0]), 0x128C},
-  { (subindex*)CANOpenShellMasterOD_Index128D,sizeof(CANOpenShellMasterOD_Index128D)/sizeof(CANOpenShellMasterOD_Index128D[0]), 0x128D},
-  { (subindex*)CANOpenShellMasterOD_Index128E,sizeof(CANOpenShellMasterOD_Index128E)/sizeof(CANOpenShellMasterOD_Index128E[0]), 0x128E},
-  { (subindex*)CANOpenShellMasterOD_Index128F,sizeof(CANOpenShellMasterOD_Index128F)/sizeof(CANOpenShellMasterOD_Index128F[0]), 0x128F},
-  { (subindex*)CANOpenShellMasterOD_Index1290,sizeof(CANOpenShellMasterOD_Index1290)/sizeof(CANOpenShellMasterOD_Index1290[0]), 0x1290},
-  { (subindex*)CANOpenShellMasterOD_Index1291,sizeof(CANOpenShellMasterOD_Index1291)/sizeof(CANOpenShellMasterOD_Index1291[0]), 0x1291},
-  { (subindex*)CANOpenShellMasterOD_Index1292,sizeof(CANOpenShellMasterOD_Index1292)/sizeof(CANOpenShellMasterOD_Index1292[0]), 0x1292},
-  { (subindex*)CANOpenShellMasterOD_Index1293,sizeof(CANOpenShellMasterOD_Index1293)/sizeof(CANOpenShellMasterOD_Index1293[0]), 0x1293},
-  { (subindex*)CANOpenShellMasterOD_Index1294,sizeof(CANOpenShellMasterOD_Index1294)/sizeof(CANOpenShellMasterOD_Index1294[0]), 0x1294},
-  { (subindex*)CANOpenShellMasterOD_Index1295,sizeof(CANOpenShellMasterOD_Index1295)/sizeof(CANOpenShellMasterOD_Index1295[0]), 0x1295},
-  { (subindex*)CANOpenShellMasterOD_Index1296,sizeof(CANOpenShellMasterOD_Index1296)/sizeof(CANOpenShellMasterOD_Index1296[0]), 0x1296},
-  { (subindex*)CANOpenShellMasterOD_Index1297,sizeof(CANOpenShellMasterOD_Index1297)/sizeof(CANOpenShellMasterOD_Index1297[0]), 0x1297},
-  { (subindex*)CANOpenShellMasterOD_Index1298,sizeof(CANOpenShellMasterOD_Index1298)/sizeof(CANOpenShellMasterOD_Index1298[0]), 0x1298},
-  { (subindex*)CANOpenShellMasterOD_Index1299,sizeof(CANOpenShellMasterOD_Index1299)/sizeof(CANOpenShellMasterOD_Index1299[0]), 0x1299},
-  { (subindex*)CANOpenShellMasterOD_Index129A,sizeof(CANOpenShellMasterOD_Index129A)/sizeof(CANOpenShellMasterOD_Index129A[0]), 0x129A},
-  { (subindex*)CANOpenShellMasterOD_Index129B,sizeof(CANOpenShellMasterOD_Index129B)/sizeof(CANOpenShellMasterOD_Index129B[0]), 0x129B},
-  { (subindex*)CANOpenShellMasterOD_Index129C,sizeof(CANOpenShellMasterOD_Index129C)/sizeof(CANOpenShellMasterOD_Index129C[0]), 0x129C},
-  { (subindex*)CANOpenShellMasterOD_Index129D,sizeof(CANOpenShellMasterOD_Index129D)/sizeof(CANOpenShellMasterOD_Index129D[0]), 0x129D},
-  { (subindex*)CANOpenShellMasterOD_Index129E,sizeof(CANOpenShellMasterOD_Index129E)/sizeof(CANOpenShellMasterOD_Index129E[0]), 0x129E},
-  { (subindex*)CANOpenShellMasterOD_Index129F,sizeof(CANOpenShellMasterOD_Index129F)/sizeof(CANOpenShellMasterOD_Index129F[0]), 0x129F},
-  { (subindex*)CANOpenShellMasterOD_Index12A0,sizeof(CANOpenShellMasterOD_Index12A0)/sizeof(CANOpenShellMasterOD_Index12A0[0]), 0x12A0},
-  { (subindex*)CANOpenShellMasterOD_Index12A1,sizeof(CANOpenShellMasterOD_Index12A1)/sizeof(CANOpenShellMasterOD_Index12A1[0]), 0x12A1},
-  { (subindex*)CANOpenShellMasterOD_Index12A2,sizeof(CANOpenShellMasterOD_Index12A2)/sizeof(CANOpenShellMasterOD_Index12A2[0]), 0x12A2},
-  { (subindex*)CANOpenShellMasterOD_Index12A3,sizeof(CANOpenShellMasterOD_Index12A3)/sizeof(CANOpenShellMasterOD_Index12A3[0]), 0x12A3},
-  { (subindex*)CANOpenShellMasterOD_Index12A4,sizeof(CANOpenShellMasterOD_Index12A4)/sizeof(CANOpenShellMasterOD_Index12A4[0]), 0x12A4},
-  { (subindex*)CANOpenShellMasterOD_Index12A5,sizeof(CANOpenShellMasterOD_Index12A5)/sizeof(CANOpenShellMasterOD_Index12A5[0]), 0x12A5},
-  { (subindex*)CANOpenShellMasterOD_Index12A6,sizeof(CANOpenShellMasterOD_Index12A6)/sizeof(CANOpenShellMasterOD_Index12A6[0]), 0x12A6},
-  { (subindex*)CANOpenShellMasterOD_Index12A7,sizeof(CANOpenShellMasterOD_Index12A7)/sizeof(CANOpenShellMasterOD_Index12A7[0]), 0x12A7},
-  { (subindex*)CANOpenShellMasterOD_Index12A8,sizeof(CANOpenShellMasterOD_Index12A8)/sizeof(CANOpenShellMasterOD_Index12A8[0]), 0x12A8},
-  { (subindex*)CANOpenShellMasterOD_Index12A9,sizeof(CANOpenShellMasterOD_Index12A9)/sizeof(CANOpenShellMasterOD_Index12A9[0]), 0x12A9},
-  { (subindex*)CANOpenShellMasterOD_Index12AA,sizeof(CANOpenShellMasterOD_Index12AA)/sizeof(CANOpenShellMasterOD_Index12AA[0]), 0x12AA},
-  { (subindex*)CANOpenShellMasterOD_Index12AB,sizeof(CANOpenShellMasterOD_Index12AB)/sizeof(CANOpenShellMasterOD_Index12AB[0]), 0x12AB},
-  { (subindex*)CANOpenShellMasterOD_Index12AC,sizeof(CANOpenShellMasterOD_Index12AC)/sizeof(CANOpenShellMasterOD_Index12AC[0]), 0x12AC},
-  { (subindex*)CANOpenShellMasterOD_Index12AD,sizeof(CANOpenShellMasterOD_Index12AD)/sizeof(CANOpenShellMasterOD_Index12AD[0]), 0x12AD},
-  { (subindex*)CANOpenShellMasterOD_Index12AE,sizeof(CANOpenShellMasterOD_Index12AE)/sizeof(CANOpenShellMasterOD_Index12AE[0]), 0x12AE},
-  { (subindex*)CANOpenShellMasterOD_Index12AF,sizeof(CANOpenShellMasterOD_Index12AF)/sizeof(CANOpenShellMasterOD_Index12AF[0]), 0x12AF},
-  { (subindex*)CANOpenShellMasterOD_Index12B0,sizeof(CANOpenShellMasterOD_Index12B0)/sizeof(CANOpenShellMasterOD_Index12B0[0]), 0x12B0},
-  { (subindex*)CANOpenShellMasterOD_Index12B1,sizeof(CANOpenShellMasterOD_Index12B1)/sizeof(CANOpenShellMasterOD_Index12B1[0]), 0x12B1},
-  { (subindex*)CANOpenShellMasterOD_Index12B2,sizeof(CANOpenShellMasterOD_Index12B2)/sizeof(CANOpenShellMasterOD_Index12B2[0]), 0x12B2},
-  { (subindex*)CANOpenShellMasterOD_Index12B3,sizeof(CANOpenShellMasterOD_Index12B3)/sizeof(CANOpenShellMasterOD_Index12B3[0]), 0x12B3},
-  { (subindex*)CANOpenShellMasterOD_Index12B4,sizeof(CANOpenShellMasterOD_Index12B4)/sizeof(CANOpenShellMasterOD_Index12B4[0]), 0x12B4},
-  { (subindex*)CANOpenShellMasterOD_Index12B5,sizeof(CANOpenShellMasterOD_Index12B5)/sizeof(CANOpenShellMasterOD_Index12B5[0]), 0x12B5},
-  { (subindex*)CANOpenShellMasterOD_Index12B6,sizeof(CANOpenShellMasterOD_Index12B6)/sizeof(CANOpenShellMasterOD_Index12B6[0]), 0x12B6},
-  { (subindex*)CANOpenShellMasterOD_Index12B7,sizeof(CANOpenShellMasterOD_Index12B7)/sizeof(CANOpenShellMasterOD_Index12B7[0]), 0x12B7},
-  { (subindex*)CANOpenShellMasterOD_Index12B8,sizeof(CANOpenShellMasterOD_Index12B8)/sizeof(CANOpenShellMasterOD_Index12B8[0]), 0x12B8},
-  { (subindex*)CANOpenShellMasterOD_Index12B9,sizeof(CANOpenShellMasterOD_Index12B9)/sizeof(CANOpenShellMasterOD_Index12B9[0]), 0x12B9},
-  { (subindex*)CANOpenShellMasterOD_Index12BA,sizeof(CANOpenShellMasterOD_Index12BA)/sizeof(CANOpenShellMasterOD_Index12BA[0]), 0x12BA},
-  { (subindex*)CANOpenShellMasterOD_Index12BB,sizeof(CANOpenShellMasterOD_Index12BB)/sizeof(CANOpenShellMasterOD_Index12BB[0]), 0x12BB},
-  { (subindex*)CANOpenShellMasterOD_Index12BC,sizeof(CANOpenShellMasterOD_Index12BC)/sizeof(CANOpenShellMasterOD_Index12BC[0]), 0x12BC},
-  { (subindex*)CANOpenShellMasterOD_Index12BD,sizeof(CANOpenShellMasterOD_Index12BD)/sizeof(CANOpenShellMasterOD_Index12BD[0]), 0x12BD},
-  { (subindex*)CANOpenShellMasterOD_Index12BE,sizeof(CANOpenShellMasterOD_Index12BE)/sizeof(CANOpenShellMasterOD_Index12BE[0]), 0x12BE},
-  { (subindex*)CANOpenShellMasterOD_Index12BF,sizeof(CANOpenShellMasterOD_Index12BF)/sizeof(CANOpenShellMasterOD_Index12BF[0]), 0x12BF},
-  { (subindex*)CANOpenShellMasterOD_Index12C0,sizeof(CANOpenShellMasterOD_Index12C0)/sizeof(CANOpenShellMasterOD_Index12C0[0]), 0x12C0},
-  { (subindex*)CANOpenShellMasterOD_Index12C1,sizeof(CANOpenShellMasterOD_Index12C1)/sizeof(CANOpenShellMasterOD_Index12C1[0]), 0x12C1},
-  { (subindex*)CANOpenShellMasterOD_Index12C2,sizeof(CANOpenShellMasterOD_Index12C2)/sizeof(CANOpenShellMasterOD_Index12C2[0]), 0x12C2},
-  { (subindex*)CANOpenShellMasterOD_Index12C3,sizeof(CANOpenShellMasterOD_Index12C3)/sizeof(CANOpenShellMasterOD_Index12C3[0]), 0x12C3},
-  { (subindex*)CANOpenShellMasterOD_Index12C4,sizeof(CANOpenShellMasterOD_Index12C4)/sizeof(CANOpenShellMasterOD_Index12C4[0]), 0x12C4},
-  { (subindex*)CANOpenShellMasterOD_Index12C5,sizeof(CANOpenShellMasterOD_Index12C5)/sizeof(CANOpenShellMasterOD_Index12C5[0]), 0x12C5},
-  { (subindex*)CANOpenShellMasterOD_Index12C6,sizeof(CANOpenShellMasterOD_Index12C6)/sizeof(CANOpenShellMasterOD_Index12C6[0]), 0x12C6},
-  { (subindex*)CANOpenShellMasterOD_Index12C7,sizeof(CANOpenShellMasterOD_Index12C7)/sizeof(CANOpenShellMasterOD_Index12C7[0]), 0x12C7},
-  { (subindex*)CANOpenShellMasterOD_Index12C8,sizeof(CANOpenShellMasterOD_Index12C8)/sizeof(CANOpenShellMasterOD_Index12C8[0]), 0x12C8},
-  { (subindex*)CANOpenShellMasterOD_Index12C9,sizeof(CANOpenShellMasterOD_Index12C9)/sizeof(CANOpenShellMasterOD_Index12C9[0]), 0x12C9},
-  { (subindex*)CANOpenShellMasterOD_Index12CA,sizeof(CANOpenShellMasterOD_Index12CA)/sizeof(CANOpenShellMasterOD_Index12CA[0]), 0x12CA},
-  { (subindex*)CANOpenShellMasterOD_Index12CB,sizeof(CANOpenShellMasterOD_Index12CB)/sizeof(CANOpenShellMasterOD_Index12CB[0]), 0x12CB},
-  { (subindex*)CANOpenShellMasterOD_Index12CC,sizeof(CANOpenShellMasterOD_Index12CC)/sizeof(CANOpenShellMasterOD_Index12CC[0]), 0x12CC},
-  { (subindex*)CANOpenShellMasterOD_Index12CD,sizeof(CANOpenShellMasterOD_Index12CD)/sizeof(CANOpenShellMasterOD_Index12CD[0]), 0x12CD},
-  { (subindex*)CANOpenShellMasterOD_Index12CE,sizeof(CANOpenShellMasterOD_Index12CE)/sizeof(CANOpenShellMasterOD_Index12CE[0]), 0x12CE},
-  { (subindex*)CANOpenShellMasterOD_Index12CF,sizeof(CANOpenShellMasterOD_Index12CF)/sizeof(CANOpenShellMasterOD_Index12CF[0]), 0x12CF},
-  { (subindex*)CANOpenShellMasterOD_Index12D0,sizeof(CANOpenShellMasterOD_Index12D0)/sizeof(CANOpenShellMasterOD_Index12D0[0]), 0x12D0},
-  { (subindex*)CANOpenShellMasterOD_Index12D1,sizeof(CANOpenShellMasterOD_Index12D1)/sizeof(CANOpenShellMasterOD_Index12D1[0]), 0x12D1},
-  { (subindex*)CANOpenShellMasterOD_Index12D2,sizeof(CANOpenShellMasterOD_Index12D2)/sizeof(CANOpenShellMasterOD_Index12D2[0]), 0x12D2},
-  { (subindex*)CANOpenShellMasterOD_Index12D3,sizeof(CANOpenShellMasterOD_Index12D3)/sizeof(CANOpenShellMasterOD_Index12D3[0]), 0x12D3},
-  { (subindex*)CANOpenShellMasterOD_Index12D4,sizeof(CANOpenShellMasterOD_Index12D4)/sizeof(CANOpenShellMasterOD_Index12D4[0]), 0x12D4},
-  { (subindex*)CANOpenShellMasterOD_Index12D5,sizeof(CANOpenShellMasterOD_Index12D5)/sizeof(CANOpenShellMasterOD_Index12D5[0]), 0x12D5},
-  { (subindex*)CANOpenShellMasterOD_Index12D6,sizeof(CANOpenShellMasterOD_Index12D6)/sizeof(CANOpenShellMasterOD_Index12D6[0]), 0x12D6},
-  { (subindex*)CANOpenShellMasterOD_Index12D7,sizeof(CANOpenShellMasterOD_Index12D7)/sizeof(CANOpenShellMasterOD_Index12D7[0]), 0x12D7},
-  { (subindex*)CANOpenShellMasterOD_Index12D8,sizeof(CANOpenShellMasterOD_Index12D8)/sizeof(CANOpenShellMasterOD_Index12D8[0]), 0x12D8},
-  { (subindex*)CANOpenShellMasterOD_Index12D9,sizeof(CANOpenShellMasterOD_Index12D9)/sizeof(CANOpenShellMasterOD_Index12D9[0]), 0x12D9},
-  { (subindex*)CANOpenShellMasterOD_Index12DA,sizeof(CANOpenShellMasterOD_Index12DA)/sizeof(CANOpenShellMasterOD_Index12DA[0]), 0x12DA},
-  { (subindex*)CANOpenShellMasterOD_Index12DB,sizeof(CANOpenShellMasterOD_Index12DB)/sizeof(CANOpenShellMasterOD_Index12DB[0]), 0x12DB},
-  { (subindex*)CANOpenShellMasterOD_Index12DC,sizeof(CANOpenShellMasterOD_Index12DC)/sizeof(CANOpenShellMasterOD_Index12DC[0]), 0x12DC},
-  { (subindex*)CANOpenShellMasterOD_Index12DD,sizeof(CANOpenShellMasterOD_Index12DD)/sizeof(CANOpenShellMasterOD_Index12DD[0]), 0x12DD},
-  { (subindex*)CANOpenShellMasterOD_Index12DE,sizeof(CANOpenShellMasterOD_Index12DE)/sizeof(CANOpenShellMasterOD_Index12DE[0]), 0x12DE},
-  { (subindex*)CANOpenShellMasterOD_Index12DF,sizeof(CANOpenShellMasterOD_Index12DF)/sizeof(CANOpenShellMasterOD_Index12DF[0]), 0x12DF},
-  { (subindex*)CANOpenShellMasterOD_Index12E0,sizeof(CANOpenShellMasterOD_Index12E0)/sizeof(CANOpenShellMasterOD_Index12E0[0]), 0x12E0},
-  { (subindex*)CANOpenShellMasterOD_Index12E1,sizeof(CANOpenShellMasterOD_Index12E1)/sizeof(CANOpenShellMasterOD_Index12E1[0]), 0x12E1},
-  { (subindex*)CANOpenShellMasterOD_Index12E2,sizeof(CANOpenShellMasterOD_Index12E2)/sizeof(CANOpenShellMasterOD_Index12E2[0]), 0x12E2},
-  { (subindex*)CANOpenShellMasterOD_Index12E3,sizeof(CANOpenShellMasterOD_Index12E3)/sizeof(CANOpenShellMasterOD_Index12E3[0]), 0x12E3},
-  { (subindex*)CANOpenShellMasterOD_Index12E4,sizeof(CANOpenShellMasterOD_Index12E4)/sizeof(CANOpenShellMasterOD_Index12E4[0]), 0x12E4},
-  { (subindex*)CANOpenShellMasterOD_Index12E5,sizeof(CANOpenShellMasterOD_Index12E5)/sizeof(CANOpenShellMasterOD_Index12E5[0]), 0x12E5},
-  { (subindex*)CANOpenShellMasterOD_Index12E6,sizeof(CANOpenShellMasterOD_Index12E6)/sizeof(CANOpenShellMasterOD_Index12E6[0]), 0x12E6},
-  { (subindex*)CANOpenShellMasterOD_Index12E7,sizeof(CANOpenShellMasterOD_Index12E7)/sizeof(CANOpenShellMasterOD_Index12E7[0]), 0x12E7},
-  { (subindex*)CANOpenShellMasterOD_Index12E8,sizeof(CANOpenShellMasterOD_Index12E8)/sizeof(CANOpenShellMasterOD_Index12E8[0]), 0x12E8},
-  { (subindex*)CANOpenShellMasterOD_Index12E9,sizeof(CANOpenShellMasterOD_Index12E9)/sizeof(CANOpenShellMasterOD_Index12E9[0]), 0x12E9},
-  { (subindex*)CANOpenShellMasterOD_Index12EA,sizeof(CANOpenShellMasterOD_Index12EA)/sizeof(CANOpenShellMasterOD_Index12EA[0]), 0x12EA},
-  { (subindex*)CANOpenShellMasterOD_Index12EB,sizeof(CANOpenShellMasterOD_Index12EB)/sizeof(CANOpenShellMasterOD_Index12EB[0]), 0x12EB},
-  { (subindex*)CANOpenShellMasterOD_Index12EC,sizeof(CANOpenShellMasterOD_Index12EC)/sizeof(CANOpenShellMasterOD_Index12EC[0]), 0x12EC},
-  { (subindex*)CANOpenShellMasterOD_Index12ED,sizeof(CANOpenShellMasterOD_Index12ED)/sizeof(CANOpenShellMasterOD_Index12ED[0]), 0x12ED},
-  { (subindex*)CANOpenShellMasterOD_Index12EE,sizeof(CANOpenShellMasterOD_Index12EE)/sizeof(CANOpenShellMasterOD_Index12EE[0]), 0x12EE},
-  { (subindex*)CANOpenShellMasterOD_Index12EF,sizeof(CANOpenShellMasterOD_Index12EF)/sizeof(CANOpenShellMasterOD_Index12EF[0]), 0x12EF},
-  { (subindex*)CANOpenShellMasterOD_Index12F0,sizeof(CANOpenShellMasterOD_Index12F0)/sizeof(CANOpenShellMasterOD_Index12F0[0]), 0x12F0},
-  { (subindex*)CANOpenShellMasterOD_Index12F1,sizeof(CANOpenShellMasterOD_Index12F1)/sizeof(CANOpenShellMasterOD_Index12F1[0]), 0x12F1},
-  { (subindex*)CANOpenShellMasterOD_Index12F2,sizeof(CANOpenShellMasterOD_Index12F2)/sizeof(CANOpenShellMasterOD_Index12F2[0]), 0x12F2},
-  { (subindex*)CANOpenShellMasterOD_Index12F3,sizeof(CANOpenShellMasterOD_Index12F3)/sizeof(CANOpenShellMasterOD_Index12F3[0]), 0x12F3},
-  { (subindex*)CANOpenShellMasterOD_Index12F4,sizeof(CANOpenShellMasterOD_Index12F4)/sizeof(CANOpenShellMasterOD_Index12F4[0]), 0x12F4},
-  { (subindex*)CANOpenShellMasterOD_Index12F5,sizeof(CANOpenShellMasterOD_Index12F5)/sizeof(CANOpenShellMasterOD_Index12F5[0]), 0x12F5},
-  { (subindex*)CANOpenShellMasterOD_Index12F6,sizeof(CANOpenShellMasterOD_Index12F6)/sizeof(CANOpenShellMasterOD_Index12F6[0]), 0x12F6},
-  { (subindex*)CANOpenShellMasterOD_Index12F7,sizeof(CANOpenShellMasterOD_Index12F7)/sizeof(CANOpenShellMasterOD_Index12F7[0]), 0x12F7},
-  { (subindex*)CANOpenShellMasterOD_Index12F8,sizeof(CANOpenShellMasterOD_Index12F8)/sizeof(CANOpenShellMasterOD_Index12F8[0]), 0x12F8},
-  { (subindex*)CANOpenShellMasterOD_Index12F9,sizeof(CANOpenShellMasterOD_Index12F9)/sizeof(CANOpenShellMasterOD_Index12F9[0]), 0x12F9},
-  { (subindex*)CANOpenShellMasterOD_Index12FA,sizeof(CANOpenShellMasterOD_Index12FA)/sizeof(CANOpenShellMasterOD_Index12FA[0]), 0x12FA},
-  { (subindex*)CANOpenShellMasterOD_Index12FB,sizeof(CANOpenShellMasterOD_Index12FB)/sizeof(CANOpenShellMasterOD_Index12FB[0]), 0x12FB},
-  { (subindex*)CANOpenShellMasterOD_Index12FC,sizeof(CANOpenShellMasterOD_Index12FC)/sizeof(CANOpenShellMasterOD_Index12FC[0]), 0x12FC},
-  { (subindex*)CANOpenShellMasterOD_Index12FD,sizeof(CANOpenShellMasterOD_Index12FD)/sizeof(CANOpenShellMasterOD_Index12FD[0]), 0x12FD},
-  { (subindex*)CANOpenShellMasterOD_Index12FE,sizeof(CANOpenShellMasterOD_Index12FE)/sizeof(CANOpenShellMasterOD_Index12FE[0]), 0x12FE},
+  SDO_REPEAT64(SDO_CLIENT_INDEX, CANOpenShellMasterOD_Index1280, 0),
+  SDO_REPEAT32(SDO_CLIENT_INDEX, CANOpenShellMasterOD_Index1280, 64),
+  SDO_REPEAT16(SDO_CLIENT_INDEX, CANOpenShellMasterOD_Index1280, 96),
+  SDO_REPEAT8(SDO_CLIENT_INDEX, CANOpenShellMasterOD_Index1280, 112),
+  SDO_REPEAT4(SDO_CLIENT_INDEX, CANOpenShellMasterOD_Index1280, 120),
+  SDO_REPEAT2(SDO_CLIENT_INDEX, CANOpenShellMasterOD_Index1280, 124),
+  SDO_REPEAT1(SDO_CLIENT_INDEX, CANOpenShellMasterOD_Index1280, 126),
   { (subindex*)CANOpenShellMasterOD_Index1400,sizeof(CANOpenShellMasterOD_Index1400)/sizeof(CANOpenShellMasterOD_Index1400[0]), 0x1400},
   { (subindex*)CANOpenShellMasterOD_Index1401,sizeof(CANOpenShellMasterOD_Index1401)/sizeof(CANOpenShellMasterOD_Index1401[0]), 0x1401},
   { (subindex*)CANOpenShellMasterOD_Index1402,sizeof(CANOpenShellMasterOD_Index1402)/sizeof(CANOpenShellMasterOD_Index1402[0]), 0x1402},
@@ -2128,133 +381,6 @@ const indextable * CANOpenShellMasterOD_scanIndexOD (UNS16 wIndex, UNS32 * error
 		case 0x1006: i = 3;*callbacks = CANOpenShellMasterOD_Index1006_callbacks; break;
 		case 0x1017: i = 4;*callbacks = CANOpenShellMasterOD_Index1017_callbacks; break;
 		case 0x1018: i = 5;break;
-		case 0x1280: i = 6;break;
-		case 0x1281: i = 7;break;
-		case 0x1282: i = 8;break;
-		case 0x1283: i = 9;break;
-		case 0x1284: i = 10;break;
-		case 0x1285: i = 11;break;
-		case 0x1286: i = 12;break;
-		case 0x1287: i = 13;break;
-		case 0x1288: i = 14;break;
-		case 0x1289: i = 15;break;
-		case 0x128A: i = 16;break;
-		case 0x128B: i = 17;break;
-		case 0x128C: i = 18;break;
-		case 0x128D: i = 19;break;
-		case 0x128E: i = 20;break;
-		case 0x128F: i = 21;break;
-		case 0x1290: i = 22;break;
-		case 0x1291: i = 23;break;
-		case 0x1292: i = 24;break;
-		case 0x1293: i = 25;break;
-		case 0x1294: i = 26;break;
-		case 0x1295: i = 27;break;
-		case 0x1296: i = 28;break;
-		case 0x1297: i = 29;break;
-		case 0x1298: i = 30;break;
-		case 0x1299: i = 31;break;
-		case 0x129A: i = 32;break;
-		case 0x129B: i = 33;break;
-		case 0x129C: i = 34;break;
-		case 0x129D: i = 35;break;
-		case 0x129E: i = 36;break;
-		case 0x129F: i = 37;break;
-		case 0x12A0: i = 38;break;
-		case 0x12A1: i = 39;break;
-		case 0x12A2: i = 40;break;
-		case 0x12A3: i = 41;break;
-		case 0x12A4: i = 42;break;
-		case 0x12A5: i = 43;break;
-		case 0x12A6: i = 44;break;
-		case 0x12A7: i = 45;break;
-		case 0x12A8: i = 46;break;
-		case 0x12A9: i = 47;break;
-		case 0x12AA: i = 48;break;
-		case 0x12AB: i = 49;break;
-		case 0x12AC: i = 50;break;
-		case 0x12AD: i = 51;break;
-		case 0x12AE: i = 52;break;
-		case 0x12AF: i = 53;break;
-		case 0x12B0: i = 54;break;
-		case 0x12B1: i = 55;break;
-		case 0x12B2: i = 56;break;
-		case 0x12B3: i = 57;break;
-		case 0x12B4: i = 58;break;
-		case 0x12B5: i = 59;break;
-		case 0x12B6: i = 60;break;
-		case 0x12B7: i = 61;break;
-		case 0x12B8: i = 62;break;
-		case 0x12B9: i = 63;break;
-		case 0x12BA: i = 64;break;
-		case 0x12BB: i = 65;break;
-		case 0x12BC: i = 66;break;
-		case 0x12BD: i = 67;break;
-		case 0x12BE: i = 68;break;
-		case 0x12BF: i = 69;break;
-		case 0x12C0: i = 70;break;
-		case 0x12C1: i = 71;break;
-		case 0x12C2: i = 72;break;
-		case 0x12C3: i = 73;break;
-		case 0x12C4: i = 74;break;
-		case 0x12C5: i = 75;break;
-		case 0x12C6: i = 76;break;
-		case 0x12C7: i = 77;break;
-		case 0x12C8: i = 78;break;
-		case 0x12C9: i = 79;break;
-		case 0x12CA: i = 80;break;
-		case 0x12CB: i = 81;break;
-		case 0x12CC: i = 82;break;
-		case 0x12CD: i = 83;break;
-		case 0x12CE: i = 84;break;
-		case 0x12CF: i = 85;break;
-		case 0x12D0: i = 86;break;
-		case 0x12D1: i = 87;break;
-		case 0x12D2: i = 88;break;
-		case 0x12D3: i = 89;break;
-		case 0x12D4: i = 90;break;
-		case 0x12D5: i = 91;break;
-		case 0x12D6: i = 92;break;
-		case 0x12D7: i = 93;break;
-		case 0x12D8: i = 94;break;
-		case 0x12D9: i = 95;break;
-		case 0x12DA: i = 96;break;
-		case 0x12DB: i = 97;break;
-		case 0x12DC: i = 98;break;
-		case 0x12DD: i = 99;break;
-		case 0x12DE: i = 100;break;
-		case 0x12DF: i = 101;break;
-		case 0x12E0: i = 102;break;
-		case 0x12E1: i = 103;break;
-		case 0x12E2: i = 104;break;
-		case 0x12E3: i = 105;break;
-		case 0x12E4: i = 106;break;
-		case 0x12E5: i = 107;break;
-		case 0x12E6: i = 108;break;
-		case 0x12E7: i = 109;break;
-		case 0x12E8: i = 110;break;
-		case 0x12E9: i = 111;break;
-		case 0x12EA: i = 112;break;
-		case 0x12EB: i = 113;break;
-		case 0x12EC: i = 114;break;
-		case 0x12ED: i = 115;break;
-		case 0x12EE: i = 116;break;
-		case 0x12EF: i = 117;break;
-		case 0x12F0: i = 118;break;
-		case 0x12F1: i = 119;break;
-		case 0x12F2: i = 120;break;
-		case 0x12F3: i = 121;break;
-		case 0x12F4: i = 122;break;
-		case 0x12F5: i = 123;break;
-		case 0x12F6: i = 124;break;
-		case 0x12F7: i = 125;break;
-		case 0x12F8: i = 126;break;
-		case 0x12F9: i = 127;break;
-		case 0x12FA: i = 128;break;
-		case 0x12FB: i = 129;break;
-		case 0x12FC: i = 130;break;
-		case 0x12FD: i = 131;break;
-		case 0x12FE: i = 132;break;
 		case 0x1400: i = 133;break;
 		case 0x1401: i = 134;break;
 		case 0x1402: i = 135;break;
@@ -2269,6 +395,7 @@ const indextable * CANOpenShellMasterOD_scanIndexOD (UNS16 wIndex, UNS32 * error
 		case 0x1605: i = 144;break;
 		case 0x2003: i = 145;*callbacks = Status3_callbacks; break;
 		default:
+			if (wIndex >= 0x1280 && wIndex <= 0x12FE) { i = 6 + wIndex - 0x1280; break; }
 			*errorCode = OD_NO_SUCH_OBJECT;
 			return NULL;
 	}
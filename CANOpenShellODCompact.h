@@ -0,0 +1,64 @@
+/*
+This file is part of CanFestival, a library implementing CanOpen Stack.
+
+Copyright (C): Edouard TISSERANT and Francis DUPIN
+
+See COPYING file for copyrights details.
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+
+
+#ifndef CANOPENSHELLODCOMPACT_H
+#define CANOPENSHELLODCOMPACT_H
+
+/* Support of the compact client SDO block written by CANOpenShellODCompact.py
+ * in place of the 0x1280 - 0x12FE entries generated by objdictgen. Every
+ * entry is computed from its position: client SDO i talks to node base + i
+ * on COB-IDs 0x600 + node and 0x580 + node. The parameters of all entries
+ * live in one array and their subindex tables in one two-dimensional
+ * array, so the stack still sees a regular indextable per index. */
+
+#include "data.h"
+
+typedef struct {
+	UNS32 cobClientToServer;
+	UNS32 cobServerToClient;
+	UNS8 highestSubIndex;
+	UNS8 nodeId;
+} sdo_client_parameter;
+
+#define SDO_CLIENT_PARAMETER(base, i) \
+	{ 0x600 + (base) + (i), 0x580 + (base) + (i), 3, (base) + (i) }
+
+#define SDO_CLIENT_SUBINDEX(param, i) { \
+	{ RO, uint8, sizeof (UNS8), (void*)&param[i].highestSubIndex }, \
+	{ RW, uint32, sizeof (UNS32), (void*)&param[i].cobClientToServer }, \
+	{ RW, uint32, sizeof (UNS32), (void*)&param[i].cobServerToClient }, \
+	{ RW, uint8, sizeof (UNS8), (void*)&param[i].nodeId } }
+
+#define SDO_CLIENT_INDEX(table, i) \
+	{ (subindex*)table[i], sizeof(table[0])/sizeof(table[0][0]), 0x1280 + (i) }
+
+/* M(a, i) for 2^n consecutive i starting at i, comma separated */
+#define SDO_REPEAT1(M, a, i) M(a, i)
+#define SDO_REPEAT2(M, a, i) SDO_REPEAT1(M, a, i), SDO_REPEAT1(M, a, (i) + 1)
+#define SDO_REPEAT4(M, a, i) SDO_REPEAT2(M, a, i), SDO_REPEAT2(M, a, (i) + 2)
+#define SDO_REPEAT8(M, a, i) SDO_REPEAT4(M, a, i), SDO_REPEAT4(M, a, (i) + 4)
+#define SDO_REPEAT16(M, a, i) SDO_REPEAT8(M, a, i), SDO_REPEAT8(M, a, (i) + 8)
+#define SDO_REPEAT32(M, a, i) SDO_REPEAT16(M, a, i), SDO_REPEAT16(M, a, (i) + 16)
+#define SDO_REPEAT64(M, a, i) SDO_REPEAT32(M, a, i), SDO_REPEAT32(M, a, (i) + 32)
+
+#endif // CANOPENSHELLODCOMPACT_H
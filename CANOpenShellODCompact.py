@@ -0,0 +1,144 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+#
+# This file is part of CanFestival, a library implementing CanOpen Stack.
+#
+# Copyright (C): Edouard TISSERANT and Francis DUPIN
+#
+# See COPYING file for copyrights details.
+#
+# This library is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# This library is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public
+# License along with this library; if not, write to the Free Software
+# Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+"""Rewrite the client SDO parameters (0x1280 - 0x12FE) of a dictionary
+generated by objdictgen into the compact form of CANOpenShellODCompact.h.
+
+    CANOpenShellODCompact.py CANOpenShellMasterOD.c
+
+The rewrite only happens when the entries are consecutive and entry i
+talks to node base + i on COB-IDs 0x600 + node / 0x580 + node, otherwise
+the file is left as generated. A file already compacted is left as is.
+"""
+
+import re
+import sys
+
+BLOCK = re.compile(
+    r"/\* index 0x(12[89A-F][0-9A-F]) :   Client SDO \d+ Parameter\. \*/\n"
+    r"\s*UNS8 (\w+)_highestSubIndex_obj\1 = 3; [^\n]*\n"
+    r"\s*UNS32 \2_obj\1_COB_ID_Client_to_Server_Transmit_SDO = 0x([0-9A-F]+);[^\n]*\n"
+    r"\s*UNS32 \2_obj\1_COB_ID_Server_to_Client_Receive_SDO = 0x([0-9A-F]+);[^\n]*\n"
+    r"\s*UNS8 \2_obj\1_Node_ID_of_the_SDO_Server = 0x([0-9A-F]+);[^\n]*\n"
+    r"\s*subindex \2_Index\1\[\] = \n"
+    r"\s*\{\n(?:\s*\{ R[OW], uint(?:8|32), sizeof \(UNS(?:8|32)\), \(void\*\)&\w+ \},?\n){4}"
+    r"\s*\};\n\n")
+
+INDENT = " " * 20
+
+
+def repeat(macro, arg, count):
+    """SDO_REPEATn expansions covering count entries"""
+    parts = []
+    start = 0
+    n = 64
+    while n:
+        if count & n:
+            parts.append("SDO_REPEAT%d(%s, %s, %d)" % (n, macro, arg, start))
+            start += n
+        n >>= 1
+    return parts
+
+
+def compact(text):
+    blocks = list(BLOCK.finditer(text))
+    if not blocks:
+        return None
+    prefix = blocks[0].group(2)
+    first = int(blocks[0].group(1), 16)
+    base = int(blocks[0].group(5), 16) - (first - 0x1280)
+    if first != 0x1280:
+        return None
+    for i, b in enumerate(blocks):
+        node = base + i
+        if (int(b.group(1), 16) != first + i or
+                int(b.group(3), 16) != 0x600 + node or
+                int(b.group(4), 16) != 0x580 + node or
+                int(b.group(5), 16) != node):
+            return None
+        if i and b.start() != blocks[i - 1].end():
+            return None
+    count = len(blocks)
+    last = first + count - 1
+    param = "%s_obj1280" % prefix
+    table = "%s_Index1280" % prefix
+
+    decl = ("/* index 0x1280 - 0x%04X :   Client SDO 1 - %d Parameters, entry i talks to node %d + i\n"
+            " * (CANOpenShellODCompact.h). */\n" % (last, count, base))
+    decl += INDENT + "sdo_client_parameter %s[%d] =\n" % (param, count)
+    decl += INDENT + " {\n"
+    decl += ",\n".join(INDENT + "   " + p for p in repeat("SDO_CLIENT_PARAMETER", base, count))
+    decl += "\n" + INDENT + " };\n"
+    decl += INDENT + "subindex %s[%d][4] =\n" % (table, count)
+    decl += INDENT + " {\n"
+    decl += ",\n".join(INDENT + "   " + p for p in repeat("SDO_CLIENT_SUBINDEX", param, count))
+    decl += "\n" + INDENT + " };\n\n"
+    text = text[:blocks[0].start()] + decl + text[blocks[-1].end():]
+
+    # objdict entries
+    entries = re.compile(
+        r"(  \{ \(subindex\*\)%s_Index(12[89A-F][0-9A-F]),sizeof\(%s_Index\2\)/sizeof\(%s_Index\2\[0\]\), 0x\2\},\n)+"
+        % (prefix, prefix, prefix))
+    m = entries.search(text)
+    if not m or m.group(0).count("\n") != count:
+        return None
+    text = text[:m.start()] + "".join(
+        "  %s,\n" % p for p in repeat("SDO_CLIENT_INDEX", table, count)) + text[m.end():]
+
+    # scanIndexOD cases, replaced by a range check
+    cases = re.compile(r"(\t\tcase 0x(12[89A-F][0-9A-F]): i = (\d+);break;\n)+")
+    m = cases.search(text)
+    if not m or m.group(0).count("\n") != count:
+        return None
+    position = int(re.match(r"\t\tcase 0x1280: i = (\d+);", m.group(0)).group(1))
+    text = text[:m.start()] + text[m.end():]
+    default = "\t\tdefault:\n"
+    at = text.index(default, m.start()) + len(default)
+    text = (text[:at] +
+            "\t\t\tif (wIndex >= 0x1280 && wIndex <= 0x%04X) { i = %d + wIndex - 0x1280; break; }\n"
+            % (last, position) + text[at:])
+
+    include = '#include "%s.h"\n' % prefix
+    text = text.replace(include, include + '#include "CANOpenShellODCompact.h"\n', 1)
+    return text
+
+
+def main(path):
+    with open(path) as f:
+        text = f.read()
+    if "CANOpenShellODCompact.h" in text:
+        return 0
+    result = compact(text)
+    if result is None:
+        sys.stderr.write("%s: client SDO entries not in the regular form, left as generated\n" % path)
+        return 0
+    with open(path, "w") as f:
+        f.write(result)
+    return 0
+
+
+if __name__ == "__main__":
+    if len(sys.argv) != 2:
+        sys.stderr.write("Usage: %s generated_od.c\n" % sys.argv[0])
+        sys.exit(1)
+    sys.exit(main(sys.argv[1]))
@@ -0,0 +1,135 @@
+/*
+This file is part of CanFestival, a library implementing CanOpen Stack.
+
+Copyright (C): Edouard TISSERANT and Francis DUPIN
+
+See COPYING file for copyrights details.
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "CANOpenShellODIndex.h"
+
+/* ODIndex_pages[index >> 8][index & 0xFF] is the objdict position + 1 of
+ * index, 0 when absent. Unused pages share ODIndex_empty, so a lookup is
+ * always two loads without a branch on the page. */
+static const UNS16 ODIndex_empty[256];
+static const UNS16 *ODIndex_pages[256];
+static const indextable *ODIndex_objdict;
+static ODCallback_t **ODIndex_callbacks;
+static ODCallback_t **ODIndex_owned;	/* callbacks allocated by ODIndex_install */
+static CO_Data *ODIndex_data;
+
+/* Release the pages of a table that is no longer used */
+static void ODIndex_free(const UNS16** pages)
+{
+	int p;
+
+	for(p = 0 ; p < 256 ; p++)
+		if (pages[p] && pages[p] != ODIndex_empty)
+			free((UNS16*)pages[p]);
+}
+
+int ODIndex_install_callbacks(CO_Data* d, ODCallback_t** callbacks)
+{
+	const UNS16 *pages[256];
+	UNS16 size = *d->ObjdictSize;
+	UNS16 *page;
+	UNS16 index;
+	UNS16 i;
+	int p;
+
+	if (ODIndex_data && ODIndex_data != d)
+		return -1;
+	if (ODIndex_objdict == d->objdict)
+		return 0;
+
+	/* Built aside, a reloaded dictionary replaces the table in one go */
+	for(p = 0 ; p < 256 ; p++)
+		pages[p] = ODIndex_empty;
+	for(i = 0 ; i < size ; i++)
+	{
+		index = d->objdict[i].index;
+		if (pages[index >> 8] == ODIndex_empty)
+		{
+			page = calloc(256, sizeof(UNS16));
+			if (!page)
+			{
+				ODIndex_free(pages);
+				return -1;
+			}
+			pages[index >> 8] = page;
+		}
+		((UNS16*)pages[index >> 8])[index & 0xFF] = i + 1;
+	}
+
+	ODIndex_free(ODIndex_pages);
+	memcpy(ODIndex_pages, pages, sizeof(pages));
+	if (ODIndex_owned != callbacks)
+	{
+		free(ODIndex_owned);
+		ODIndex_owned = NULL;
+	}
+	ODIndex_callbacks = callbacks;
+	ODIndex_objdict = d->objdict;
+	ODIndex_data = d;
+	d->scanIndexOD = ODIndex_scan;
+	return 0;
+}
+
+int ODIndex_install(CO_Data* d)
+{
+	UNS16 size = *d->ObjdictSize;
+	ODCallback_t **callbacks;
+	UNS32 errorCode;
+	UNS16 i;
+
+	if (ODIndex_data && ODIndex_data != d)
+		return -1;
+	if (ODIndex_objdict == d->objdict)
+		return 0;
+
+	callbacks = calloc(size, sizeof(ODCallback_t*));
+	if (!callbacks)
+		return -1;
+	for(i = 0 ; i < size ; i++)
+		d->scanIndexOD(d->objdict[i].index, &errorCode, &callbacks[i]);
+	if (ODIndex_install_callbacks(d, callbacks) == 0)
+	{
+		ODIndex_owned = callbacks;
+		return 0;
+	}
+	free(callbacks);
+	return -1;
+}
+
+const indextable* ODIndex_scan(UNS16 wIndex, UNS32* errorCode, ODCallback_t** callbacks)
+{
+	UNS16 i = ODIndex_pages[wIndex >> 8][wIndex & 0xFF];
+
+	if (!i)
+	{
+		*callbacks = NULL;
+		*errorCode = OD_NO_SUCH_OBJECT;
+		return NULL;
+	}
+	*callbacks = ODIndex_callbacks[i - 1];
+	*errorCode = OD_SUCCESSFUL;
+	return &ODIndex_objdict[i - 1];
+}
@@ -0,0 +1,44 @@
+/*
+This file is part of CanFestival, a library implementing CanOpen Stack.
+
+Copyright (C): Edouard TISSERANT and Francis DUPIN
+
+See COPYING file for copyrights details.
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+
+
+#ifndef CANOPENSHELLODINDEX_H
+#define CANOPENSHELLODINDEX_H
+
+#include "canfestival.h"
+
+/* Replace the generated scanIndexOD switch of d with a two-level table
+ * over the 16-bit index space, built from d->objdict and the callbacks
+ * the generated function returns. The objdict arrays are left untouched.
+ * scanIndexOD has no CO_Data argument, so only one dictionary can be
+ * indexed per process. Call before the stack runs, and again after
+ * d->objdict was replaced to rebuild the table. */
+int ODIndex_install(CO_Data* d);
+
+/* Same for a dictionary without generated scanIndexOD: callbacks[i] is
+ * the callback array of d->objdict[i], kept by the index. */
+int ODIndex_install_callbacks(CO_Data* d, ODCallback_t** callbacks);
+
+/* The table lookup, with the scanIndexOD signature */
+const indextable* ODIndex_scan(UNS16 wIndex, UNS32* errorCode, ODCallback_t** callbacks);
+
+#endif // CANOPENSHELLODINDEX_H
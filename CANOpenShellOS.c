@@ -0,0 +1,264 @@
+/*
+This file is part of CanFestival, a library implementing CanOpen Stack.
+
+Copyright (C): Edouard TISSERANT and Francis DUPIN
+
+See COPYING file for copyrights details.
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+
+
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "CANOpenShellOS.h"
+
+enum { OS_STEP_COMMAND, OS_STEP_STATUS, OS_STEP_REPLY };
+
+/* Commands of one node, the head one is executing */
+typedef struct {
+	OS_command *head;
+	OS_command *tail;
+	TIMER_HANDLE timer;	/* status poll backoff */
+	UNS32 lastReplySize;
+	UNS8 noBlock;		/* node refused a block upload */
+} OS_context;
+
+static OS_context OS_contexts[MAX_NODES + 1];
+
+int OS_block_mode = OS_BLOCK_AUTO;
+
+static pthread_mutex_t OS_done_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t OS_done_cond = PTHREAD_COND_INITIALIZER;
+
+static void OS_start(CO_Data* d, UNS8 nodeId);
+
+OS_command* OS_command_new(UNS8 nodeId, const char* command)
+{
+	OS_command *cmd = calloc(1, sizeof(OS_command));
+
+	if (!cmd)
+		return NULL;
+	cmd->nodeId = nodeId;
+	strncpy(cmd->command, command, SDO_DATA_SIZE - 1);
+	cmd->timeout = OS_TIMEOUT_US;
+	cmd->reply = "";
+	return cmd;
+}
+
+void OS_free(OS_command* cmd)
+{
+	if (cmd)
+		SDO_free(cmd->req);
+	free(cmd);
+}
+
+long OS_latency_us(const OS_command* cmd)
+{
+	return (cmd->end.tv_sec - cmd->start.tv_sec) * 1000000l +
+		(cmd->end.tv_nsec - cmd->start.tv_nsec) / 1000;
+}
+
+static long OS_elapsed_us(const OS_command* cmd)
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (now.tv_sec - cmd->start.tv_sec) * 1000000l +
+		(now.tv_nsec - cmd->start.tv_nsec) / 1000;
+}
+
+/* Report the head command of a node and start the next one */
+static void OS_finish(CO_Data* d, OS_command* cmd, UNS8 result, UNS32 abortCode)
+{
+	OS_context *ctx = &OS_contexts[cmd->nodeId];
+	UNS8 nodeId = cmd->nodeId;
+
+	ctx->head = cmd->next;
+	if (!ctx->head)
+		ctx->tail = NULL;
+
+	clock_gettime(CLOCK_MONOTONIC, &cmd->end);
+	cmd->next = NULL;
+	cmd->result = result;
+	cmd->abortCode = abortCode;
+
+	pthread_mutex_lock(&OS_done_lock);
+	cmd->done = 1;
+	pthread_cond_broadcast(&OS_done_cond);
+	pthread_mutex_unlock(&OS_done_lock);
+
+	OS_start(d, nodeId);
+}
+
+/* Queue the next transfer of a command on its request */
+static void OS_transfer(CO_Data* d, OS_command* cmd, int step)
+{
+	cmd->step = step;
+	SDO_enqueue(d, cmd->req);
+}
+
+static void OS_read_status(CO_Data* d, OS_command* cmd)
+{
+	SDO_request_read(cmd->req, 0x1023, 0x02, uint8, 0);
+	OS_transfer(d, cmd, OS_STEP_STATUS);
+}
+
+static void OS_read_reply(CO_Data* d, OS_command* cmd)
+{
+	OS_context *ctx = &OS_contexts[cmd->nodeId];
+
+	cmd->blockMode = !ctx->noBlock && (OS_block_mode == OS_BLOCK_ON ||
+			(OS_block_mode == OS_BLOCK_AUTO && ctx->lastReplySize > OS_BLOCK_THRESHOLD));
+	SDO_request_read(cmd->req, 0x1023, 0x03, visible_string, cmd->blockMode);
+	OS_transfer(d, cmd, OS_STEP_REPLY);
+}
+
+static void OS_poll_alarm(CO_Data* d, UNS32 nodeId)
+{
+	OS_command *cmd = OS_contexts[nodeId].head;
+
+	OS_contexts[nodeId].timer = TIMER_NONE;
+	if (cmd)
+		OS_read_status(d, cmd);
+}
+
+static void OS_status(CO_Data* d, OS_command* cmd)
+{
+	switch(cmd->status)
+	{
+		case OS_STATUS_EXECUTING:
+			if (OS_elapsed_us(cmd) >= (long)cmd->timeout)
+			{
+				OS_finish(d, cmd, SDO_ABORTED_INTERNAL, SDOABT_TIMED_OUT);
+				break;
+			}
+			OS_contexts[cmd->nodeId].timer = SetAlarm(d, cmd->nodeId, OS_poll_alarm, US_TO_TIMEVAL(cmd->backoff), 0);
+			if (OS_contexts[cmd->nodeId].timer == TIMER_NONE)
+			{
+				/* Timer table full: the status would never be asked again */
+				OS_finish(d, cmd, SDO_ABORTED_INTERNAL, SDOABT_OUT_OF_MEMORY);
+				break;
+			}
+			cmd->backoff *= 2;
+			if (cmd->backoff > OS_POLL_MAX_US)
+				cmd->backoff = OS_POLL_MAX_US;
+			break;
+		case OS_STATUS_REPLY:
+		case OS_STATUS_ERROR_REPLY:
+			OS_read_reply(d, cmd);
+			break;
+		default:
+			OS_finish(d, cmd, SDO_FINISHED, 0);
+	}
+}
+
+/* Completion of one transfer of the head command of a node */
+static void OS_callback(CO_Data* d, SDO_request* req)
+{
+	OS_command *cmd = req->user;
+	OS_context *ctx = &OS_contexts[cmd->nodeId];
+
+	if (req->result != SDO_FINISHED)
+	{
+		/* The node has no status subindex: read the reply directly */
+		if (cmd->step == OS_STEP_STATUS && req->result == SDO_ABORTED_RCV && cmd->polls == 0)
+			OS_read_reply(d, cmd);
+		/* The node does not support block upload: fall back to segmented */
+		else if (cmd->step == OS_STEP_REPLY && req->result == SDO_ABORTED_RCV && cmd->blockMode)
+		{
+			ctx->noBlock = 1;
+			OS_read_reply(d, cmd);
+		}
+		else
+			OS_finish(d, cmd, req->result, req->abortCode);
+		return;
+	}
+
+	switch(cmd->step)
+	{
+		case OS_STEP_COMMAND:
+			cmd->backoff = OS_POLL_MIN_US;
+			OS_read_status(d, cmd);
+			break;
+		case OS_STEP_STATUS:
+			cmd->status = (UNS8)req->data[0];
+			cmd->polls++;
+			OS_status(d, cmd);
+			break;
+		default:
+			cmd->reply = req->data;
+			cmd->replySize = req->size;
+			ctx->lastReplySize = req->size;
+			OS_finish(d, cmd, SDO_FINISHED, 0);
+	}
+}
+
+/* Put the head command of a node on the bus. Called with the stack mutex held. */
+static void OS_start(CO_Data* d, UNS8 nodeId)
+{
+	OS_command *cmd = OS_contexts[nodeId].head;
+
+	if (!cmd)
+		return;
+	clock_gettime(CLOCK_MONOTONIC, &cmd->start);
+	cmd->req = SDO_write_request(nodeId, 0x1023, 0x01, strlen(cmd->command), visible_string, cmd->command, 0);
+	if (!cmd->req)
+	{
+		OS_finish(d, cmd, SDO_ABORTED_INTERNAL, SDOABT_OUT_OF_MEMORY);
+		return;
+	}
+	cmd->req->callback = OS_callback;
+	cmd->req->user = cmd;
+	OS_transfer(d, cmd, OS_STEP_COMMAND);
+}
+
+void OS_submit(CO_Data* d, OS_command* cmd)
+{
+	OS_context *ctx;
+
+	EnterMutex();
+	if (cmd->nodeId == 0 || cmd->nodeId > MAX_NODES)
+	{
+		cmd->result = SDO_ABORTED_INTERNAL;
+		cmd->abortCode = SDOABT_LOCAL_CTRL_ERROR;
+		cmd->done = 1;
+		LeaveMutex();
+		return;
+	}
+	ctx = &OS_contexts[cmd->nodeId];
+	cmd->next = NULL;
+	if (ctx->tail)
+		ctx->tail->next = cmd;
+	else
+	{
+		ctx->head = cmd;
+		ctx->timer = TIMER_NONE;
+	}
+	ctx->tail = cmd;
+	if (ctx->head == cmd)
+		OS_start(d, cmd->nodeId);
+	LeaveMutex();
+}
+
+void OS_wait(OS_command* cmd)
+{
+	pthread_mutex_lock(&OS_done_lock);
+	while (!cmd->done)
+		pthread_cond_wait(&OS_done_cond, &OS_done_lock);
+	pthread_mutex_unlock(&OS_done_lock);
+}
@@ -0,0 +1,84 @@
+/*
+This file is part of CanFestival, a library implementing CanOpen Stack.
+
+Copyright (C): Edouard TISSERANT and Francis DUPIN
+
+See COPYING file for copyrights details.
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+
+#ifndef CANOPENSHELLOS_H
+#define CANOPENSHELLOS_H
+
+#include <time.h>
+
+#include "canfestival.h"
+#include "CANOpenShellSDO.h"
+
+/* OS command object 0x1023, subindex 2 (status) */
+#define OS_STATUS_NO_REPLY		0x00
+#define OS_STATUS_REPLY			0x01
+#define OS_STATUS_ERROR_NO_REPLY	0x02
+#define OS_STATUS_ERROR_REPLY		0x03
+#define OS_STATUS_EXECUTING		0xFF
+
+#define OS_TIMEOUT_US 5000000
+#define OS_POLL_MIN_US 250
+#define OS_POLL_MAX_US 10000
+
+/* Reply transfer mode */
+#define OS_BLOCK_OFF	0
+#define OS_BLOCK_ON	1
+#define OS_BLOCK_AUTO	2	/* block transfer once a node sent a long reply */
+#define OS_BLOCK_THRESHOLD 32	/* bytes, above this block transfer needs fewer frames */
+
+extern int OS_block_mode;
+
+typedef struct OS_command OS_command;
+
+/* One interpreter command sent through the OS command object: the command
+ * is written to 0x1023:01, the status 0x1023:02 is polled with an
+ * exponential backoff while the interpreter is executing, then the reply
+ * is read from 0x1023:03. All steps reuse one SDO request whose buffer
+ * grows to the size of the reply. */
+struct OS_command {
+	OS_command *next;	/* per-node FIFO */
+	UNS8 nodeId;
+	char command[SDO_DATA_SIZE];
+	UNS32 timeout;		/* us, whole command */
+	/* results */
+	UNS8 result;		/* SDO_FINISHED or result of the failing transfer */
+	UNS32 abortCode;
+	UNS8 status;		/* last value of 0x1023:02 */
+	UNS16 polls;
+	const char *reply;	/* NUL terminated, valid until OS_free() */
+	UNS32 replySize;
+	UNS8 blockMode;		/* reply read with block transfer */
+	struct timespec start;	/* CLOCK_MONOTONIC, command put on the bus */
+	struct timespec end;
+	volatile int done;
+	int step;
+	UNS32 backoff;
+	SDO_request *req;
+};
+
+OS_command* OS_command_new(UNS8 nodeId, const char* command);
+void OS_submit(CO_Data* d, OS_command* cmd);	/* takes the stack mutex */
+void OS_wait(OS_command* cmd);
+void OS_free(OS_command* cmd);
+long OS_latency_us(const OS_command* cmd);
+
+#endif // CANOPENSHELLOS_H
@@ -0,0 +1,493 @@
+/*
+This file is part of CanFestival, a library implementing CanOpen Stack.
+
+Copyright (C): Edouard TISSERANT and Francis DUPIN
+
+See COPYING file for copyrights details.
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+
+
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+#include "CANOpenShellParam.h"
+
+#define PARAM_WRITE 0
+#define PARAM_DISABLE 1		/* mapping subindex 0 set to 0 */
+#define PARAM_VERIFY 2
+#define PARAM_INVALIDATE 3	/* PDO COB-ID with bit 31 set */
+#define PARAM_VALIDATE 4	/* PDO COB-ID restored */
+#define PARAM_COBID_INVALID 0x80000000
+
+/* One SDO transfer of a download */
+typedef struct {
+	SDO_request *req;
+	const EDS_object *o;
+	UNS8 kind;
+} Param_step;
+
+/* COB-ID of the PDO of a mapping the download writes. The node may
+ * refuse a mapping change while its PDO exists, so the PDO is made
+ * invalid around it. */
+typedef struct {
+	EDS_object invalid;
+	EDS_object valid;	/* size 0 when the COB-ID is unknown */
+	UNS32 invalidValue;
+	UNS32 validValue;
+	SDO_request *req;	/* reading the COB-ID the set does not write */
+} Param_pdo;
+
+static const char *Param_kinds[] = {"write", "disable", "verify", "invalidate", "validate"};
+
+static int Param_mapping(UNS16 index)
+{
+	return (index >= 0x1600 && index <= 0x17FF) || (index >= 0x1A00 && index <= 0x1BFF);
+}
+
+/* Communication parameter of a mapping: 0x1400 + n for 0x1600 + n, 0x1800 + n for 0x1A00 + n */
+static UNS16 Param_communication(UNS16 index)
+{
+	return index - 0x200;
+}
+
+/* Parse one CSV line, the value goes to value when not NULL */
+static int Param_csv_line(char* s, EDS_object* o, UNS8* value)
+{
+	unsigned int index;
+	unsigned int subIndex;
+	unsigned int size;
+	unsigned long long data;
+	char *end;
+	int used;
+
+	if (sscanf(s, "%x,%x,%x,%n", &index, &subIndex, &size, &used) != 3 || index > 0xFFFF || subIndex > 0xFF)
+		return -1;
+	s += used;
+	while (*s == ' ')
+		s++;
+	o->index = index;
+	o->subIndex = subIndex;
+	o->access = RW;
+	o->dcf = 1;
+	if (*s == '"')
+	{
+		end = strchr(++s, '"');
+		if (!end)
+			return -1;
+		o->dataType = visible_string;
+		o->size = end - s;
+		if (value)
+			memcpy(value, s, o->size);
+		return 0;
+	}
+	if (size < 1 || size > 8)
+		return -1;
+	data = strtoull(s, &end, 16);
+	if (end == s)
+		return -1;
+	o->dataType = 0;
+	o->size = size;
+	if (value)
+		memcpy(value, &data, size);	/* little endian host */
+	return 0;
+}
+
+static int Param_csv(const char* path, EDS_object** set, int* line)
+{
+	EDS_object o;
+	EDS_object *objects = NULL;
+	UNS8 *value = NULL;
+	char buf[1024];
+	char *s;
+	size_t bytes = 0;
+	int n = 0;
+	int pass;
+	int i = 0;
+	FILE *f;
+
+	*line = 0;
+	f = fopen(path, "r");
+	if (!f)
+		return -1;
+	/* Sizes first, then one allocation for objects and values */
+	for(pass = 0 ; pass < 2 ; pass++)
+	{
+		rewind(f);
+		*line = 0;
+		while (fgets(buf, sizeof(buf), f))
+		{
+			(*line)++;
+			for(s = buf ; *s == ' ' || *s == '\t' ; s++)
+				;
+			if (*s == '\0' || *s == '\n' || *s == '\r' || *s == '#' || *s == ';')
+				continue;
+			if (Param_csv_line(s, pass ? &objects[i] : &o, pass ? value : NULL) != 0)
+			{
+				fclose(f);
+				free(objects);
+				return -1;
+			}
+			if (pass)
+			{
+				objects[i].value = value;
+				value += (objects[i++].size + 7) & ~7;
+			}
+			else
+			{
+				n++;
+				bytes += (o.size + 7) & ~7;
+			}
+		}
+		if (pass == 0)
+		{
+			objects = calloc(1, n * sizeof(EDS_object) + bytes);
+			if (!objects)
+			{
+				fclose(f);
+				return -1;
+			}
+			value = (UNS8*)(objects + n);
+		}
+	}
+	fclose(f);
+	*line = 0;
+	*set = objects;
+	return n;
+}
+
+int Param_load(const char* path, UNS8 nodeId, EDS_object** set, int* line)
+{
+	const char *dot = strrchr(path, '.');
+	int dcf = 0;
+	int n;
+	int i;
+	int k;
+
+	if (dot && strcasecmp(dot, ".csv") == 0)
+		return Param_csv(path, set, line);
+
+	n = EDS_objects(path, nodeId, set, line);
+	for(i = 0 ; i < n ; i++)
+		dcf |= (*set)[i].dcf;
+	/* The configured values, leaving identity and other constants alone */
+	for(i = k = 0 ; i < n ; i++)
+		if ((*set)[i].value && (*set)[i].access != RO && (*set)[i].size && (!dcf || (*set)[i].dcf))
+			(*set)[k++] = (*set)[i];
+	return n < 0 ? n : k;
+}
+
+static void Param_add(CO_Data* d, UNS8 nodeId, const EDS_object* o, UNS8 kind, Param_step* step)
+{
+	static const UNS8 zero;
+	UNS8 block = o->size > PARAM_BLOCK_SIZE;
+	SDO_request *req;
+
+	if (kind == PARAM_VERIFY)
+	{
+		req = SDO_read_request(nodeId, o->index, o->subIndex, o->dataType, block);
+		if (req)
+			req->useCache = 0;
+	}
+	else if (kind == PARAM_DISABLE)
+		req = SDO_write_request(nodeId, o->index, 0, 1, uint8, &zero, 0);
+	else
+		req = SDO_write_request(nodeId, o->index, o->subIndex, o->size, o->dataType, o->value, block);
+	if (req)
+		SDO_submit(d, req);
+	step->req = req;
+	step->o = o;
+	step->kind = kind;
+}
+
+/* Written again later in the set, only the last value is read back */
+static int Param_rewritten(const EDS_object* set, int n, int i)
+{
+	int j;
+
+	for(j = i + 1 ; j < n ; j++)
+		if (set[j].index == set[i].index && set[j].subIndex == set[i].subIndex)
+			return 1;
+	return 0;
+}
+
+/* Mapping objects set[first] to set[last - 1], disabled while they change */
+static int Param_disabled(const EDS_object* set, int first, int last)
+{
+	return Param_mapping(set[first].index) && set[first].subIndex == 0 && last - first > 1 &&
+		!Param_rewritten(set, last, first);
+}
+
+static void Param_pdo_set(Param_pdo* pdo, UNS16 index, UNS32 cobid)
+{
+	pdo->validValue = cobid;
+	pdo->invalidValue = cobid | PARAM_COBID_INVALID;
+	pdo->valid.index = index;
+	pdo->valid.subIndex = 1;
+	pdo->valid.dataType = uint32;
+	pdo->valid.access = RW;
+	pdo->valid.size = 4;
+	pdo->valid.value = (UNS8*)&pdo->validValue;
+	pdo->invalid = pdo->valid;
+	pdo->invalid.value = (UNS8*)&pdo->invalidValue;
+}
+
+/* COB-ID of every mapping of the set, pdos[first] for
+ * the mapping at set[first]: the last one the set writes, otherwise read
+ * from the node. The reads of all nodes run in parallel. */
+static void Param_pdo_prepare(CO_Data* d, UNS8 nodeId, const EDS_object* set, int n, Param_pdo* pdos)
+{
+	UNS16 index;
+	UNS32 cobid;
+	int first;
+	int last;
+	int found;
+	int i;
+
+	for(first = 0 ; first < n ; first = last)
+	{
+		for(last = first + 1 ; last < n && set[last].index == set[first].index ; last++)
+			;
+		if (!Param_mapping(set[first].index))
+			continue;
+		index = Param_communication(set[first].index);
+		found = 0;
+		for(i = 0 ; i < n ; i++)
+			if (set[i].index == index && set[i].subIndex == 1 && set[i].size == 4)
+			{
+				memcpy(&cobid, set[i].value, 4);	/* little endian host */
+				found = 1;
+			}
+		if (found)
+			Param_pdo_set(&pdos[first], index, cobid);
+		else
+		{
+			pdos[first].valid.index = index;
+			pdos[first].req = SDO_read_request(nodeId, index, 1, uint32, 0);
+			if (pdos[first].req)
+			{
+				pdos[first].req->useCache = 0;
+				SDO_submit(d, pdos[first].req);
+			}
+		}
+	}
+}
+
+/* Wait for the COB-ID reads of a node. A mapping whose COB-ID cannot be
+ * read is still written, without touching its PDO. */
+static void Param_pdo_read(Param_pdo* pdos, int n, Param_report* report, FILE* out)
+{
+	SDO_request *req;
+	UNS32 cobid = 0;
+	int i;
+
+	for(i = 0 ; i < n ; i++)
+	{
+		req = pdos[i].req;
+		if (!req)
+			continue;
+		SDO_wait(req);
+		if (req->result == SDO_FINISHED && req->size == 4)
+		{
+			memcpy(&cobid, req->data, 4);
+			Param_pdo_set(&pdos[i], pdos[i].valid.index, cobid);
+		}
+		else
+		{
+			report->failed++;
+			fprintf(out, "%2.2x  %4.4x:01  read aborted %8.8x\n", report->nodeId,
+					pdos[i].valid.index, req->abortCode);
+		}
+		SDO_free(req);
+		pdos[i].req = NULL;
+	}
+}
+
+/* Queue the whole download of a node, in order on its channel */
+static int Param_queue(CO_Data* d, UNS8 nodeId, const EDS_object* set, int n, int verify,
+		const Param_pdo* pdos, Param_step* steps)
+{
+	int count = 0;
+	int first;
+	int last;
+	int i;
+
+	for(first = 0 ; first < n ; first = last)
+	{
+		for(last = first + 1 ; last < n && set[last].index == set[first].index ; last++)
+			;
+		/* A mapping changes inside its PDO made invalid */
+		if (pdos[first].valid.size)
+			Param_add(d, nodeId, &pdos[first].invalid, PARAM_INVALIDATE, &steps[count++]);
+		if (Param_disabled(set, first, last))
+		{
+			/* Disabled while its entries change, enabled last */
+			Param_add(d, nodeId, &set[first], PARAM_DISABLE, &steps[count++]);
+			for(i = first + 1 ; i < last ; i++)
+				Param_add(d, nodeId, &set[i], PARAM_WRITE, &steps[count++]);
+			Param_add(d, nodeId, &set[first], PARAM_WRITE, &steps[count++]);
+		}
+		else
+			for(i = first ; i < last ; i++)
+				Param_add(d, nodeId, &set[i], PARAM_WRITE, &steps[count++]);
+		if (pdos[first].valid.size)
+			Param_add(d, nodeId, &pdos[first].valid, PARAM_VALIDATE, &steps[count++]);
+	}
+	if (verify)
+		for(i = 0 ; i < n ; i++)
+			if (set[i].access != WO && !Param_rewritten(set, n, i))
+				Param_add(d, nodeId, &set[i], PARAM_VERIFY, &steps[count++]);
+	return count;
+}
+
+static UNS64 Param_integer(const void* data, UNS32 size)
+{
+	UNS64 value = 0;
+
+	memcpy(&value, data, size < 8 ? size : 8);	/* little endian host */
+	return value;
+}
+
+/* Wait for one transfer, count it and print what went wrong. A failed
+ * write sets writeFailed (one flag per object of the set) so that its
+ * readback is not reported again. */
+static void Param_check(Param_step* step, const EDS_object* set, UNS8* writeFailed,
+		Param_report* report, FILE* out)
+{
+	SDO_request *req = step->req;
+	const EDS_object *o = step->o;
+
+	if (step->kind == PARAM_VERIFY && writeFailed[o - set])
+	{
+		if (req)
+			SDO_wait(req);
+		SDO_free(req);
+		return;
+	}
+
+	if (!req)
+	{
+		if (step->kind <= PARAM_VERIFY)
+			writeFailed[o - set] = 1;
+		report->failed++;
+		fprintf(out, "%2.2x  %4.4x:%2.2x  %s not queued, out of memory\n", report->nodeId,
+				o->index, o->subIndex, Param_kinds[step->kind]);
+		return;
+	}
+	SDO_wait(req);
+	if (req->result != SDO_FINISHED)
+	{
+		if (step->kind <= PARAM_VERIFY)
+			writeFailed[o - set] = 1;
+		report->failed++;
+		fprintf(out, "%2.2x  %4.4x:%2.2x  %s aborted %8.8x\n", report->nodeId,
+				o->index, step->kind == PARAM_DISABLE ? 0 : o->subIndex,
+				Param_kinds[step->kind], req->abortCode);
+	}
+	else if (step->kind == PARAM_WRITE)
+		report->written++;
+	else if (step->kind == PARAM_VERIFY)
+	{
+		if (req->size == o->size && memcmp(req->data, o->value, o->size) == 0)
+			report->verified++;
+		else if (req->size == o->size && o->size <= 8 && o->dataType != visible_string)
+		{
+			report->failed++;
+			fprintf(out, "%2.2x  %4.4x:%2.2x  verify read %llx instead of %llx\n",
+					report->nodeId, o->index, o->subIndex,
+					(unsigned long long)Param_integer(req->data, req->size),
+					(unsigned long long)Param_integer(o->value, o->size));
+		}
+		else
+		{
+			report->failed++;
+			fprintf(out, "%2.2x  %4.4x:%2.2x  verify read %u bytes different from the %u written\n",
+					report->nodeId, o->index, o->subIndex, req->size, o->size);
+		}
+	}
+	SDO_free(req);
+}
+
+long Param_download(CO_Data* d, const char* path, const UNS8* nodes, int count, int verify,
+		Param_report* reports, FILE* out)
+{
+	EDS_object **sets = calloc(count, sizeof(EDS_object*));
+	Param_step **steps = calloc(count, sizeof(Param_step*));
+	Param_pdo **pdos = calloc(count, sizeof(Param_pdo*));
+	UNS8 *writeFailed = NULL;
+	int *queued = calloc(count, sizeof(int));
+	UNS64 start;
+	long elapsed = -1;
+	int line;
+	int n;
+	int i;
+	int j;
+
+	if (!sets || !steps || !pdos || !queued)
+		goto done;
+	/* Every parameter set before the first write ($NODEID differs) */
+	for(i = 0 ; i < count ; i++)
+	{
+		memset(&reports[i], 0, sizeof(Param_report));
+		reports[i].nodeId = nodes[i];
+		n = Param_load(path, nodes[i], &sets[i], &line);
+		if (n < 0)
+		{
+			if (line)
+				fprintf(out, "%s:%d: syntax error\n", path, line);
+			else
+				perror(path);
+			goto done;
+		}
+		reports[i].objects = n;
+		steps[i] = malloc((4 * n + 1) * sizeof(Param_step));
+		pdos[i] = calloc(n + 1, sizeof(Param_pdo));
+		if (!steps[i] || !pdos[i])
+			goto done;
+	}
+
+	start = SDO_now();
+	for(i = 0 ; i < count ; i++)
+		Param_pdo_prepare(d, nodes[i], sets[i], reports[i].objects, pdos[i]);
+	for(i = 0 ; i < count ; i++)
+		Param_pdo_read(pdos[i], reports[i].objects, &reports[i], out);
+	for(i = 0 ; i < count ; i++)
+		queued[i] = Param_queue(d, nodes[i], sets[i], reports[i].objects, verify, pdos[i], steps[i]);
+	for(i = 0 ; i < count ; i++)
+	{
+		writeFailed = calloc(reports[i].objects + 1, 1);
+		if (!writeFailed)
+			goto done;	/* requests left in the queues */
+		for(j = 0 ; j < queued[i] ; j++)
+			Param_check(&steps[i][j], sets[i], writeFailed, &reports[i], out);
+		free(writeFailed);
+	}
+	elapsed = (SDO_now() - start) / 1000;
+
+done:
+	for(i = 0 ; sets && steps && pdos && i < count ; i++)
+	{
+		free(sets[i]);
+		free(steps[i]);
+		free(pdos[i]);
+	}
+	free(sets);
+	free(steps);
+	free(pdos);
+	free(queued);
+	return elapsed;
+}
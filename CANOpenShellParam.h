@@ -0,0 +1,65 @@
+/*
+This file is part of CanFestival, a library implementing CanOpen Stack.
+
+Copyright (C): Edouard TISSERANT and Francis DUPIN
+
+See COPYING file for copyrights details.
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+
+
+#ifndef CANOPENSHELLPARAM_H
+#define CANOPENSHELLPARAM_H
+
+#include <stdio.h>
+
+#include "canfestival.h"
+#include "CANOpenShellEDS.h"
+#include "CANOpenShellSDO.h"
+
+#define PARAM_BLOCK_SIZE 32	/* larger values are written and read back with block transfer */
+
+typedef struct {
+	UNS8 nodeId;
+	UNS32 objects;
+	UNS32 written;		/* writes acknowledged */
+	UNS32 verified;		/* read back equal */
+	UNS32 failed;		/* write aborted, readback aborted or different */
+} Param_report;
+
+/* Parameter set of a DCF or EDS file (the ParameterValue entries, or
+ * every writable value when the file has none) or of a CSV file: one
+ * "index,subindex,size,data" line per object, in hex as .wsdo, data in
+ * double quotes for strings. Read-only objects are left out. Returns the
+ * number of objects, *set being released with free(), or -1 with *line
+ * set to the offending line (0 when the file cannot be read). */
+int Param_load(const char* path, UNS8 nodeId, EDS_object** set, int* line);
+
+/* Write the parameter set of path to every node, all nodes at once and
+ * the objects of each node back to back on its SDO channel. A PDO mapping
+ * (0x1600 - 0x17FF, 0x1A00 - 0x1BFF) is written disabled: subindex 0 set
+ * to 0, the entries, then subindex 0, unless the set does it itself, and
+ * with its PDO invalid: COB-ID (0x1400 / 0x1800 + n subindex 1, from the
+ * set or read from the node first) with bit 31 set before, then the
+ * COB-ID itself. If
+ * verify, every object is read back after the writes and compared with
+ * the last value written to it. Failures are printed on out as they are
+ * found. Returns the total time in us, or -1 if the file of a
+ * node cannot be loaded. Must be called WITHOUT the stack mutex held. */
+long Param_download(CO_Data* d, const char* path, const UNS8* nodes, int count, int verify,
+		Param_report* reports, FILE* out);
+
+#endif // CANOPENSHELLPARAM_H
@@ -0,0 +1,206 @@
+/*
+This file is part of CanFestival, a library implementing CanOpen Stack.
+
+Copyright (C): Edouard TISSERANT and Francis DUPIN
+
+See COPYING file for copyrights details.
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+
+
+#define _GNU_SOURCE
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+
+#include "CANOpenShellRT.h"
+#include "CANOpenShellSDO.h"
+
+typedef struct {
+	volatile int valid;
+	pid_t tid;
+	int policy;
+	int priority;
+	cpu_set_t cpus;
+} RT_thread;
+
+static const char* RT_names[RT_THREADS] = { "main", "timer", "receive" };
+static RT_thread RT_threads[RT_THREADS];
+static int RT_locked;
+
+/* Main thread settings before RT_setup() */
+static int RT_policy = SCHED_OTHER;
+static struct sched_param RT_param;
+static cpu_set_t RT_cpus;
+static int RT_saved;
+
+static void RT_fill(RT_thread* t)
+{
+	struct sched_param param;
+
+	t->tid = syscall(SYS_gettid);
+	pthread_getschedparam(pthread_self(), &t->policy, &param);
+	t->priority = param.sched_priority;
+	CPU_ZERO(&t->cpus);
+	pthread_getaffinity_np(pthread_self(), sizeof(t->cpus), &t->cpus);
+	t->valid = 1;
+}
+
+int RT_setup(int priority, int cpu, int lock)
+{
+	struct sched_param param;
+	cpu_set_t cpus;
+
+	pthread_getschedparam(pthread_self(), &RT_policy, &RT_param);
+	pthread_getaffinity_np(pthread_self(), sizeof(RT_cpus), &RT_cpus);
+	RT_saved = 1;
+
+	if (lock)
+	{
+		if (mlockall(MCL_CURRENT | MCL_FUTURE) != 0)
+			return -1;
+		RT_locked = 1;
+	}
+	if (cpu >= 0)
+	{
+		CPU_ZERO(&cpus);
+		CPU_SET(cpu, &cpus);
+		if ((errno = pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus)) != 0)
+			return -1;
+	}
+	if (priority > 0)
+	{
+		memset(&param, 0, sizeof(param));
+		param.sched_priority = priority;
+		if ((errno = pthread_setschedparam(pthread_self(), SCHED_FIFO, &param)) != 0)
+			return -1;
+	}
+	return 0;
+}
+
+void RT_restore(void)
+{
+	if (!RT_saved)
+		return;
+	pthread_setschedparam(pthread_self(), RT_policy, &RT_param);
+	pthread_setaffinity_np(pthread_self(), sizeof(RT_cpus), &RT_cpus);
+}
+
+void RT_record(int thread)
+{
+	if (!RT_threads[thread].valid)
+		RT_fill(&RT_threads[thread]);
+}
+
+static void RT_print_thread(FILE* out, const char* name, const RT_thread* t)
+{
+	int cpu;
+	int first = 1;
+
+	fprintf(out, "  %-8s %6d  %-11s %3d  ", name, (int)t->tid,
+			t->policy == SCHED_FIFO ? "SCHED_FIFO" : t->policy == SCHED_RR ? "SCHED_RR" : "SCHED_OTHER",
+			t->priority);
+	if (CPU_COUNT(&t->cpus) == sysconf(_SC_NPROCESSORS_ONLN))
+		fprintf(out, "all");
+	else
+		for(cpu = 0 ; cpu < CPU_SETSIZE ; cpu++)
+			if (CPU_ISSET(cpu, &t->cpus))
+			{
+				fprintf(out, first ? "%d" : ",%d", cpu);
+				first = 0;
+			}
+	fprintf(out, "\n");
+}
+
+void RT_print(FILE* out)
+{
+	RT_thread self;
+	int i;
+
+	RT_fill(&self);
+	fprintf(out, "  thread      tid  policy     prio  cpus\n");
+	RT_print_thread(out, RT_names[RT_THREAD_MAIN], &self);
+	for(i = RT_THREAD_TIMER ; i < RT_THREADS ; i++)
+		if (RT_threads[i].valid)
+			RT_print_thread(out, RT_names[i], &RT_threads[i]);
+		else
+			fprintf(out, "  %-8s not seen yet\n", RT_names[i]);
+	fprintf(out, "  memory %s\n", RT_locked ? "locked" : "not locked");
+}
+
+/* Latency measurement: an alarm re-armed from its own callback */
+static pthread_mutex_t RT_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t RT_cond = PTHREAD_COND_INITIALIZER;
+static RT_latency_stats *RT_stats;
+static UNS32 RT_samples;
+static UNS32 RT_period;
+static UNS64 RT_due;
+
+static void RT_alarm(CO_Data* d, UNS32 id)
+{
+	UNS64 now = SDO_now();
+	UNS64 late = now > RT_due ? now - RT_due : 0;
+
+	RT_record(RT_THREAD_TIMER);
+	if (!RT_stats->samples || late < RT_stats->min)
+		RT_stats->min = late;
+	if (late > RT_stats->max)
+		RT_stats->max = late;
+	RT_stats->sum += late;
+	if (++RT_stats->samples < RT_samples)
+	{
+		RT_due = SDO_now() + RT_period * 1000ull;
+		if (SetAlarm(d, 0, &RT_alarm, US_TO_TIMEVAL(RT_period), 0) != TIMER_NONE)
+			return;
+		/* No alarm left: end the measurement with what was sampled */
+		RT_stats->missed = RT_samples - RT_stats->samples;
+	}
+	pthread_mutex_lock(&RT_mutex);
+	pthread_cond_signal(&RT_cond);
+	pthread_mutex_unlock(&RT_mutex);
+}
+
+int RT_latency(CO_Data* d, UNS32 samples, UNS32 period, RT_latency_stats* stats)
+{
+	TIMER_HANDLE timer;
+
+	memset(stats, 0, sizeof(*stats));
+	if (!samples)
+		return 0;
+	RT_stats = stats;
+	RT_samples = samples;
+	RT_period = period;
+
+	pthread_mutex_lock(&RT_mutex);
+	EnterMutex();
+	RT_due = SDO_now() + period * 1000ull;
+	timer = SetAlarm(d, 0, &RT_alarm, US_TO_TIMEVAL(period), 0);
+	LeaveMutex();
+	if (timer == TIMER_NONE)
+	{
+		pthread_mutex_unlock(&RT_mutex);
+		return -1;
+	}
+	while (stats->samples + stats->missed < samples)
+		pthread_cond_wait(&RT_cond, &RT_mutex);
+	pthread_mutex_unlock(&RT_mutex);
+	return 0;
+}
@@ -0,0 +1,62 @@
+/*
+This file is part of CanFestival, a library implementing CanOpen Stack.
+
+Copyright (C): Edouard TISSERANT and Francis DUPIN
+
+See COPYING file for copyrights details.
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+
+
+#ifndef CANOPENSHELLRT_H
+#define CANOPENSHELLRT_H
+
+#include <stdio.h>
+
+#include "canfestival.h"
+
+#define RT_THREAD_MAIN 0
+#define RT_THREAD_TIMER 1
+#define RT_THREAD_RECEIVE 2
+#define RT_THREADS 3
+
+#define RT_LATENCY_SAMPLES 1000
+#define RT_LATENCY_PERIOD_US 1000
+
+typedef struct {
+	UNS32 samples;
+	UNS64 min;		/* ns, alarm callback time minus due time */
+	UNS64 max;
+	UNS64 sum;
+	UNS32 missed;		/* samples lost, re-arm refused (timer table full) */
+} RT_latency_stats;
+
+/* Give the calling (main) thread SCHED_FIFO priority (0: keep the default
+ * policy), pin it to cpu (-1: any) and lock memory if lock. Call before
+ * TimerInit() and canOpen() so that the timer and CAN receive threads
+ * inherit the settings, then RT_restore() once the node is initialised. */
+int RT_setup(int priority, int cpu, int lock);
+void RT_restore(void);
+
+/* Remember the scheduling of the calling thread, once per thread kind */
+void RT_record(int thread);
+void RT_print(FILE* out);
+
+/* Measure how late the timer thread runs alarms of period us. Stack mutex
+ * NOT held. */
+int RT_latency(CO_Data* d, UNS32 samples, UNS32 period, RT_latency_stats* stats);
+
+#endif // CANOPENSHELLRT_H
@@ -0,0 +1,460 @@
+/*
+This file is part of CanFestival, a library implementing CanOpen Stack.
+
+Copyright (C): Edouard TISSERANT and Francis DUPIN
+
+See COPYING file for copyrights details.
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "CANOpenShellSDO.h"
+#include "CANOpenShellCache.h"
+
+#define RETRY_US 1000
+
+#ifndef SDO_PROVIDED_BUFFER_TOO_SMALL
+#define SDO_PROVIDED_BUFFER_TOO_SMALL 0x8A
+#endif
+
+SDO_context SDO_contexts[MAX_NODES + 1];
+
+static pthread_mutex_t SDO_done_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t SDO_done_cond = PTHREAD_COND_INITIALIZER;
+
+static void SDO_start(CO_Data* d, UNS8 nodeId);
+
+int SDO_init(void)
+{
+	int i;
+
+	for(i = 0 ; i <= MAX_NODES ; i++)
+	{
+		SDO_contexts[i].head = SDO_contexts[i].tail = NULL;
+		SDO_contexts[i].timer = TIMER_NONE;
+	}
+	return 0;
+}
+
+UNS64 SDO_now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (UNS64)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+static SDO_request* SDO_request_new(UNS8 nodeId, UNS16 index, UNS8 subIndex, UNS8 dataType, UNS8 useBlockMode)
+{
+	SDO_request *req = calloc(1, sizeof(SDO_request));
+
+	if (!req)
+		return NULL;
+	req->nodeId = nodeId;
+	req->index = index;
+	req->subIndex = subIndex;
+	req->dataType = dataType;
+	req->useBlockMode = useBlockMode;
+	req->timeout = SDO_TIMEOUT_US;
+	req->useCache = 1;
+	req->data = req->buffer;
+	req->capacity = SDO_DATA_SIZE;
+	return req;
+}
+
+/* Make room for capacity bytes, keeping the current content */
+static int SDO_grow(SDO_request* req, UNS32 capacity)
+{
+	char *data;
+
+	if (capacity <= req->capacity)
+		return 0;
+	if (req->data == req->buffer)
+	{
+		data = malloc(capacity);
+		if (data)
+			memcpy(data, req->buffer, req->capacity);
+	}
+	else
+		data = realloc(req->data, capacity);
+	if (!data)
+		return -1;
+	req->data = data;
+	req->capacity = capacity;
+	return 0;
+}
+
+SDO_request* SDO_read_request(UNS8 nodeId, UNS16 index, UNS8 subIndex, UNS8 dataType, UNS8 useBlockMode)
+{
+	return SDO_request_new(nodeId, index, subIndex, dataType, useBlockMode);
+}
+
+SDO_request* SDO_write_request(UNS8 nodeId, UNS16 index, UNS8 subIndex, UNS32 count,
+		UNS8 dataType, const void* data, UNS8 useBlockMode)
+{
+	SDO_request *req;
+
+	req = SDO_request_new(nodeId, index, subIndex, dataType, useBlockMode);
+	if (!req)
+		return NULL;
+	if (SDO_grow(req, count + 1))
+	{
+		SDO_free(req);
+		return NULL;
+	}
+	req->write = 1;
+	req->size = count;
+	memcpy(req->data, data, count);
+	return req;
+}
+
+void SDO_request_read(SDO_request* req, UNS16 index, UNS8 subIndex, UNS8 dataType, UNS8 useBlockMode)
+{
+	req->write = 0;
+	req->index = index;
+	req->subIndex = subIndex;
+	req->dataType = dataType;
+	req->useBlockMode = useBlockMode;
+	req->size = 0;
+	req->result = 0;
+	req->abortCode = 0;
+}
+
+void SDO_free(SDO_request* req)
+{
+	if (req && req->data != req->buffer)
+		free(req->data);
+	free(req);
+}
+
+/* Hand a finished request to its callback or to the waiting threads */
+static void SDO_report(CO_Data* d, SDO_request* req, UNS8 result, UNS32 abortCode)
+{
+	req->next = NULL;
+	req->result = result;
+	req->abortCode = abortCode;
+	if (req->callback)
+	{
+		req->done = 1;
+		req->callback(d, req);
+	}
+	else
+	{
+		pthread_mutex_lock(&SDO_done_lock);
+		req->done = 1;
+		pthread_cond_broadcast(&SDO_done_cond);
+		pthread_mutex_unlock(&SDO_done_lock);
+	}
+}
+
+/* Remove the head request of a node, report it and start the next one */
+static void SDO_complete(CO_Data* d, UNS8 nodeId, UNS8 result, UNS32 abortCode)
+{
+	SDO_context *ctx = &SDO_contexts[nodeId];
+	SDO_request *req = ctx->head;
+
+	ctx->head = req->next;
+	if (!ctx->head)
+		ctx->tail = NULL;
+	ctx->timer = DelAlarm(ctx->timer);
+
+	/* A read queued before a write may have cached the old value */
+	if (req->write)
+		Cache_forget(nodeId, req->index, req->subIndex);
+	else if (result == SDO_FINISHED)
+		Cache_store(nodeId, req->index, req->subIndex, req->data, req->size);
+	SDO_report(d, req, result, abortCode);
+
+	SDO_start(d, nodeId);
+}
+
+/* Bytes uploaded on the client line of a node, 0 if unknown */
+static UNS32 SDO_line_count(CO_Data* d, UNS8 nodeId)
+{
+	UNS8 client = GetSDOClientFromNodeId(d, nodeId);
+	UNS8 line;
+
+	if (client >= 0xFE || getSDOlineOnUse(d, client, SDO_CLIENT, &line))
+		return 0;
+	/* Segmented upload without size indicated: offset is the size */
+	return d->transfers[line].count ? d->transfers[line].count : d->transfers[line].offset;
+}
+
+/* Callback function that collects the SDO result of the head request */
+static void SDO_callback(CO_Data* d, UNS8 nodeid)
+{
+	SDO_request *req = SDO_contexts[nodeid].head;
+	UNS32 abortCode = 0;
+	UNS8 result;
+
+	if (!req)
+	{
+		closeSDOtransfer(d, nodeid, SDO_CLIENT);
+		return;
+	}
+
+	if (req->write)
+		result = getWriteResultNetworkDict(d, nodeid, &abortCode);
+	else
+	{
+		/* The stack copies at most size bytes, once: with
+		 * SDO_DYNAMIC_BUFFER_ALLOCATION it frees the data of the line
+		 * after the copy. Size the buffer to the transfer first. */
+		if (SDO_grow(req, SDO_line_count(d, nodeid) + 1))
+		{
+			result = SDO_ABORTED_INTERNAL;
+			abortCode = SDOABT_OUT_OF_MEMORY;
+		}
+		else
+		{
+			req->size = req->capacity - 1;
+			result = getReadResultNetworkDict(d, nodeid, req->data, &req->size, &abortCode);
+			if (result == SDO_PROVIDED_BUFFER_TOO_SMALL)
+			{
+				result = SDO_ABORTED_INTERNAL;
+				abortCode = SDOABT_OUT_OF_MEMORY;
+			}
+		}
+		if (result != SDO_FINISHED)
+			req->size = 0;
+		req->data[req->size] = 0;
+	}
+
+	/* Finalize last SDO transfer with this node */
+	closeSDOtransfer(d, nodeid, SDO_CLIENT);
+	SDO_complete(d, nodeid, result, abortCode);
+}
+
+/* The node did not answer in time: drop the transfer so that a late
+ * answer cannot complete the next request */
+static void SDO_timeout_alarm(CO_Data* d, UNS32 nodeId)
+{
+	SDO_contexts[nodeId].timer = TIMER_NONE;
+	closeSDOtransfer(d, (UNS8)nodeId, SDO_CLIENT);
+	SDO_complete(d, (UNS8)nodeId, SDO_ABORTED_INTERNAL, SDOABT_TIMED_OUT);
+}
+
+/* Whether a request that found no free SDO line may try again: every
+ * RETRY_US for one timeout, then for up to maxRequeues more timeouts */
+static int SDO_may_retry(SDO_request* req)
+{
+	if ((UNS32)++req->retries * RETRY_US < req->timeout)
+		return 1;
+	if (req->requeues >= req->maxRequeues)
+		return 0;
+	req->requeues++;
+	req->retries = 0;
+	return 1;
+}
+
+static void SDO_retry_alarm(CO_Data* d, UNS32 nodeId)
+{
+	SDO_contexts[nodeId].timer = TIMER_NONE;
+	SDO_start(d, (UNS8)nodeId);
+}
+
+/* Put the head request of a node on the bus. Called with the stack mutex held. */
+static void SDO_start(CO_Data* d, UNS8 nodeId)
+{
+	SDO_context *ctx = &SDO_contexts[nodeId];
+	SDO_request *req = ctx->head;
+	UNS8 err;
+
+	/* A retry already planned starts it */
+	if (!req || req->started || ctx->timer != TIMER_NONE)
+		return;
+	/* No client SDO for the node in the dictionary: no line ever frees up */
+	if (GetSDOClientFromNodeId(d, nodeId) >= 0xFE)
+	{
+		SDO_complete(d, nodeId, SDO_ABORTED_INTERNAL, SDO_NO_CHANNEL);
+		return;
+	}
+
+	if (req->write)
+		err = writeNetworkDictCallBack(d, nodeId, req->index, req->subIndex, req->size,
+				req->dataType, req->data, SDO_callback, req->useBlockMode);
+	else
+		err = readNetworkDictCallback(d, nodeId, req->index, req->subIndex,
+				req->dataType, SDO_callback, req->useBlockMode);
+
+	if (err == 0)
+	{
+		req->started = 1;
+		ctx->timer = SetAlarm(d, nodeId, SDO_timeout_alarm, US_TO_TIMEVAL(req->timeout), 0);
+		if (ctx->timer == TIMER_NONE)
+		{
+			/* Timer table full (MAX_NB_TIMER): nothing would end the transfer */
+			closeSDOtransfer(d, nodeId, SDO_CLIENT);
+			SDO_complete(d, nodeId, SDO_ABORTED_INTERNAL, SDOABT_OUT_OF_MEMORY);
+		}
+	}
+	else if (err == 0xFF && SDO_may_retry(req))
+	{
+		/* No free SDO line: more than SDO_MAX_SIMULTANEOUS_TRANSFERS
+		 * transfers in flight, or a transfer with this node was started
+		 * outside of the queue. Try again shortly. */
+		ctx->timer = SetAlarm(d, nodeId, SDO_retry_alarm, US_TO_TIMEVAL(RETRY_US), 0);
+		if (ctx->timer == TIMER_NONE)
+			SDO_complete(d, nodeId, SDO_ABORTED_INTERNAL, SDOABT_OUT_OF_MEMORY);
+	}
+	else
+		SDO_complete(d, nodeId, SDO_ABORTED_INTERNAL, SDOABT_LOCAL_CTRL_ERROR);
+}
+
+void SDO_enqueue(CO_Data* d, SDO_request* req)
+{
+	SDO_context *ctx;
+	const Cache_entry *cached;
+
+	req->started = 0;
+	req->retries = 0;
+	req->requeues = 0;
+	req->done = 0;
+	if (req->nodeId == 0 || req->nodeId > MAX_NODES)
+	{
+		SDO_report(d, req, SDO_ABORTED_INTERNAL, SDOABT_LOCAL_CTRL_ERROR);
+		return;
+	}
+
+	if (req->write)
+		Cache_forget(req->nodeId, req->index, req->subIndex);
+	else if (req->useCache && (cached = Cache_lookup(req->nodeId, req->index, req->subIndex)) &&
+			SDO_grow(req, cached->size + 1) == 0)
+	{
+		/* Static object already read since the node booted */
+		memcpy(req->data, cached->data, cached->size);
+		req->size = cached->size;
+		req->data[req->size] = 0;
+		SDO_report(d, req, SDO_FINISHED, 0);
+		return;
+	}
+
+	ctx = &SDO_contexts[req->nodeId];
+	req->next = NULL;
+	if (ctx->tail)
+		ctx->tail->next = req;
+	else
+		ctx->head = req;
+	ctx->tail = req;
+	SDO_start(d, req->nodeId);
+}
+
+void SDO_submit(CO_Data* d, SDO_request* req)
+{
+	EnterMutex();
+	SDO_enqueue(d, req);
+	LeaveMutex();
+}
+
+void SDO_wait(SDO_request* req)
+{
+	pthread_mutex_lock(&SDO_done_lock);
+	while (!req->done)
+		pthread_cond_wait(&SDO_done_cond, &SDO_done_lock);
+	pthread_mutex_unlock(&SDO_done_lock);
+}
+
+void SDO_wait_all(SDO_request** reqs, int n)
+{
+	int i;
+
+	for(i = 0 ; i < n ; i++)
+		if (reqs[i])
+			SDO_wait(reqs[i]);
+}
+
+/* Wait until one of the requests is completed and return its position.
+ * NULL entries are skipped; returns -1 when there is nothing to wait for. */
+int SDO_wait_any(SDO_request** reqs, int n)
+{
+	int i;
+	int pending;
+
+	pthread_mutex_lock(&SDO_done_lock);
+	for(;;)
+	{
+		pending = 0;
+		for(i = 0 ; i < n ; i++)
+		{
+			if (!reqs[i])
+				continue;
+			if (reqs[i]->done)
+			{
+				pthread_mutex_unlock(&SDO_done_lock);
+				return i;
+			}
+			pending = 1;
+		}
+		if (!pending)
+			break;
+		pthread_cond_wait(&SDO_done_cond, &SDO_done_lock);
+	}
+	pthread_mutex_unlock(&SDO_done_lock);
+	return -1;
+}
+
+/* Read a slave node object dictionary entry */
+UNS8 SDO_read(CO_Data* d, UNS8 nodeId, UNS16 index, UNS8 subIndex, UNS8 dataType,
+		UNS8 useBlockMode, void* data, UNS32* size, UNS32* abortCode)
+{
+	SDO_request *req = SDO_read_request(nodeId, index, subIndex, dataType, useBlockMode);
+	UNS8 result;
+
+	if (!req)
+		return SDO_ABORTED_INTERNAL;
+	SDO_submit(d, req);
+	SDO_wait(req);
+
+	result = req->result;
+	if (abortCode)
+		*abortCode = req->abortCode;
+	if (size)
+	{
+		if (result != SDO_FINISHED)
+			*size = 0;
+		else if (*size > req->size)
+			*size = req->size;
+		if (data)
+			memcpy(data, req->data, *size);
+	}
+	SDO_free(req);
+
+	return result;
+}
+
+/* Write a slave node object dictionnary entry */
+UNS8 SDO_write(CO_Data* d, UNS8 nodeId, UNS16 index, UNS8 subIndex, UNS32 count,
+		UNS8 dataType, void* data, UNS8 useBlockMode, UNS32* abortCode)
+{
+	SDO_request *req = SDO_write_request(nodeId, index, subIndex, count, dataType, data, useBlockMode);
+	UNS8 result;
+
+	if (!req)
+		return SDO_ABORTED_INTERNAL;
+	SDO_submit(d, req);
+	SDO_wait(req);
+
+	result = req->result;
+	if (abortCode)
+		*abortCode = req->abortCode;
+	SDO_free(req);
+
+	return result;
+}
@@ -0,0 +1,112 @@
+/*
+This file is part of CanFestival, a library implementing CanOpen Stack.
+
+Copyright (C): Edouard TISSERANT and Francis DUPIN
+
+See COPYING file for copyrights details.
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+
+#ifndef CANOPENSHELLSDO_H
+#define CANOPENSHELLSDO_H
+
+#include <pthread.h>
+
+#include "canfestival.h"
+
+#define MAX_NODES 127
+#define SDO_DATA_SIZE 256
+#define SDO_TIMEOUT_US 500000
+#define SDO_NO_CHANNEL SDOABT_GENERAL_ERROR	/* abortCode: the dictionary has no client SDO for the node */
+/* Timeouts to wait for a line when every SDO line is held by a silent node:
+ * those free up SDO_MAX_SIMULTANEOUS_TRANSFERS lines per timeout */
+#define SDO_MAX_REQUEUES (MAX_NODES / SDO_MAX_SIMULTANEOUS_TRANSFERS + 1)
+
+typedef struct SDO_request SDO_request;
+typedef void (*SDO_done_t)(CO_Data* d, SDO_request* req);
+
+/* One queued SDO upload or download. Fill in the optional fields after
+ * SDO_read_request()/SDO_write_request() and before submitting. */
+struct SDO_request {
+	SDO_request *next;	/* per-node FIFO */
+	UNS8 nodeId;
+	UNS8 write;		/* 0: upload, 1: download */
+	UNS16 index;
+	UNS8 subIndex;
+	UNS8 dataType;
+	UNS8 useBlockMode;
+	UNS32 timeout;		/* us, from the start of the transfer on the bus */
+	UNS8 useCache;		/* uploads of static objects may come from the cache (default) */
+	UNS8 maxRequeues;	/* timeouts to wait for a free SDO line after the first (default 0) */
+	SDO_done_t callback;	/* optional, called in stack context on completion */
+	void *user;
+	/* results */
+	UNS8 result;		/* SDO_FINISHED, SDO_ABORTED_RCV or SDO_ABORTED_INTERNAL */
+	UNS32 abortCode;
+	volatile int done;
+	UNS8 started;
+	UNS16 retries;
+	UNS8 requeues;
+	UNS32 size;		/* bytes to send / bytes received */
+	UNS32 capacity;
+	char *data;		/* grows to fit the uploaded data, NUL terminated */
+	char buffer[SDO_DATA_SIZE];
+};
+
+/* Queue of one remote node. Each node is reached through its own client
+ * SDO channel (0x1280 + nodeid - 1): requests to the same node run in
+ * order, requests to different nodes run in parallel. */
+typedef struct {
+	SDO_request *head;	/* head is the transfer in progress */
+	SDO_request *tail;
+	TIMER_HANDLE timer;	/* timeout or retry alarm of head */
+} SDO_context;
+
+extern SDO_context SDO_contexts[MAX_NODES + 1];
+
+int SDO_init(void);
+
+/* CLOCK_MONOTONIC in ns, the time base of every shell module */
+UNS64 SDO_now(void);
+
+/* Asynchronous API. A request without callback is completed through
+ * SDO_wait*() and released by the caller with SDO_free(). A request with
+ * a callback is handed to it on completion and must not be waited for.
+ * A completed request may be turned into a new upload with
+ * SDO_request_read() and queued again, keeping its grown buffer. */
+SDO_request* SDO_read_request(UNS8 nodeId, UNS16 index, UNS8 subIndex, UNS8 dataType, UNS8 useBlockMode);
+SDO_request* SDO_write_request(UNS8 nodeId, UNS16 index, UNS8 subIndex, UNS32 count,
+		UNS8 dataType, const void* data, UNS8 useBlockMode);
+void SDO_request_read(SDO_request* req, UNS16 index, UNS8 subIndex, UNS8 dataType, UNS8 useBlockMode);
+void SDO_submit(CO_Data* d, SDO_request* req);	/* takes the stack mutex */
+void SDO_enqueue(CO_Data* d, SDO_request* req);	/* stack mutex already held */
+void SDO_wait(SDO_request* req);
+void SDO_wait_all(SDO_request** reqs, int n);
+int SDO_wait_any(SDO_request** reqs, int n);
+void SDO_free(SDO_request* req);
+
+/* Blocking SDO upload/download. Must be called WITHOUT the stack mutex
+ * held; safe to call from several threads at once. Returns SDO_FINISHED
+ * on success, otherwise SDO_ABORTED_RCV or SDO_ABORTED_INTERNAL with
+ * *abortCode set (SDOABT_TIMED_OUT when the reply did not arrive in time,
+ * SDO_NO_CHANNEL at once when there is no client SDO for the node,
+ * SDOABT_OUT_OF_MEMORY when the stack timer table is full). */
+UNS8 SDO_read(CO_Data* d, UNS8 nodeId, UNS16 index, UNS8 subIndex, UNS8 dataType,
+		UNS8 useBlockMode, void* data, UNS32* size, UNS32* abortCode);
+UNS8 SDO_write(CO_Data* d, UNS8 nodeId, UNS16 index, UNS8 subIndex, UNS32 count,
+		UNS8 dataType, void* data, UNS8 useBlockMode, UNS32* abortCode);
+
+#endif // CANOPENSHELLSDO_H
@@ -0,0 +1,1161 @@
+/*
+This file is part of CanFestival, a library implementing CanOpen Stack.
+
+Copyright (C): Edouard TISSERANT and Francis DUPIN
+
+See COPYING file for copyrights details.
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+
+
+/* In-process simulated CAN bus, loaded like any CanFestival driver:
+ *
+ *   load#./libcanfestival_can_shellsim.so,<bus>[:<nodelist>],<baudrate>,<nodeid>,<type>
+ *
+ * Every port opened on the same bus name receives the frames sent by the
+ * others, delayed by the time they would take on the wire at <baudrate>
+ * ("0" for no delay). The first port on a bus also creates the simulated
+ * nodes of <nodelist> (hex ids and ranges, e.g. 0:01-14). They answer
+ * NMT commands, node guarding and SDO (expedited and segmented) and
+ * produce heartbeats. They also run an OS interpreter behind 0x1023 and
+ * 0x1024: a command written to 0x1023:01 reports status 255 on 0x1023:02
+ * until the interpreter latency has elapsed, then status 1 and a reply on
+ * 0x1023:03 made of the command text repeated to the reply size.
+ * SDO block transfers are served without CRC.
+ * Tunables come from the CANOPENSHELL_SIM environment variable,
+ * e.g. CANOPENSHELL_SIM=heartbeat=100,response=50,os=2000,reply=64
+ *   heartbeat=<ms>   heartbeat period of the simulated nodes (0x1017)
+ *   response=<us>    SDO server processing time
+ *   os=<us>          OS interpreter latency
+ *   osjitter=<us>    random extra OS interpreter latency, up to this value
+ *   reply=<bytes>    OS reply size, 0 for commands without reply
+ *   blksize=<n>      segments per block of block downloads (1 to 127)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <time.h>
+
+#include "can_driver.h"
+
+#define SIM_QUEUE 4096		/* frames per port, power of two */
+#define SIM_MAX_NODES 127
+
+#define SIM_STATE_BOOTUP	0x00
+#define SIM_STATE_STOPPED	0x04
+#define SIM_STATE_OPERATIONAL	0x05
+#define SIM_STATE_PREOP		0x7F
+
+#define SIM_OS_STATUS_DONE	0x00
+#define SIM_OS_STATUS_REPLY	0x01
+#define SIM_OS_STATUS_ERROR	0x02
+#define SIM_OS_STATUS_BUSY	0xFF
+
+#define SIM_BLOCK_SIZE		127	/* segments per block, at most 127 */
+#define SIM_OUTBOX		256	/* SDO frames waiting for the wire, power of two */
+
+enum { SIM_SDO_IDLE, SIM_SDO_DOWNLOAD, SIM_SDO_UPLOAD,
+	SIM_SDO_BLOCK_DOWNLOAD, SIM_SDO_BLOCK_DOWNLOAD_END, SIM_SDO_BLOCK_UPLOAD };
+
+typedef struct {
+	Message m;
+	UNS64 ready;		/* CLOCK_MONOTONIC ns, when the frame is on the wire */
+} SimFrame;
+
+/* Entry of a simulated node dictionary */
+typedef struct {
+	UNS16 index;
+	UNS8 subIndex;
+	UNS8 readOnly;
+	UNS32 size;
+	UNS8 *data;
+} SimObject;
+
+typedef struct {
+	UNS8 id;
+	UNS8 state;
+	UNS8 guardToggle;
+	UNS16 heartbeat;	/* ms */
+	UNS64 nextHeartbeat;
+	/* OS interpreter */
+	int osBusy;
+	UNS64 osDone;
+	unsigned int seed;
+	/* SDO server */
+	UNS8 sdoState;
+	UNS8 toggle;
+	UNS16 index;
+	UNS8 subIndex;
+	UNS32 offset;
+	UNS32 size;
+	UNS8 *buffer;
+	UNS32 capacity;
+	UNS8 blockSize;		/* block transfer: segments per block */
+	UNS8 sequence;		/* last segment received in the block */
+	UNS8 last;		/* last segment of the transfer received */
+	UNS32 blockStart;	/* offset of the block being uploaded */
+	/* SDO answers, ready once the processing time has elapsed */
+	SimFrame outbox[SIM_OUTBOX];
+	UNS32 outHead;
+	UNS32 outTail;
+	UNS64 ready;		/* last answer */
+	/* dictionary */
+	SimObject *objects;
+	UNS32 count;
+	UNS32 allocated;
+} SimNode;
+
+typedef struct SimBus SimBus;
+
+typedef struct SimPort {
+	SimBus *bus;
+	struct SimPort *next;
+	SimFrame queue[SIM_QUEUE];
+	UNS32 head;
+	UNS32 tail;
+	UNS32 dropped;
+	int open;
+	pthread_cond_t cond;
+} SimPort;
+
+struct SimBus {
+	SimBus *next;
+	char name[32];
+	pthread_mutex_t lock;
+	SimPort *ports;
+	SimNode *nodes[SIM_MAX_NODES + 1];
+	UNS32 bitrate;		/* bit/s, 0: no wire delay */
+	UNS64 busyUntil;	/* end of the last frame on the wire */
+	UNS32 pending;		/* frames in the outboxes of the nodes */
+	UNS32 response;		/* ns */
+};
+
+static pthread_mutex_t Sim_buses_lock = PTHREAD_MUTEX_INITIALIZER;
+static SimBus *Sim_buses;
+
+static UNS64 Sim_now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (UNS64)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+/* Value of key in CANOPENSHELL_SIM, or def */
+static long Sim_config(const char* key, long def)
+{
+	const char *env = getenv("CANOPENSHELL_SIM");
+	size_t len = strlen(key);
+
+	while (env && *env)
+	{
+		if (strncmp(env, key, len) == 0 && env[len] == '=')
+			return strtol(env + len + 1, NULL, 0);
+		env = strchr(env, ',');
+		if (env)
+			env++;
+	}
+	return def;
+}
+
+static UNS32 Sim_bitrate(const char* baudrate)
+{
+	char *end;
+	unsigned long rate = strtoul(baudrate, &end, 10);
+
+	if (*end == 'K' || *end == 'k')
+		rate *= 1000;
+	else if (*end == 'M' || *end == 'm')
+		rate *= 1000000;
+	return rate;
+}
+
+/***************************  WIRE  *****************************************/
+
+static void Sim_push(SimPort* port, const Message* m, UNS64 ready)
+{
+	if (port->head - port->tail == SIM_QUEUE)
+	{
+		port->dropped++;
+		return;
+	}
+	port->queue[port->head & (SIM_QUEUE - 1)].m = *m;
+	port->queue[port->head & (SIM_QUEUE - 1)].ready = ready;
+	port->head++;
+	pthread_cond_signal(&port->cond);
+}
+
+/* Start a frame on the wire no earlier than at and hand it to every port
+ * but from. Returns the time the frame has been fully transmitted. */
+static UNS64 Sim_place(SimBus* bus, const Message* m, UNS64 at, SimPort* from)
+{
+	SimPort *port;
+	UNS64 ready = at > bus->busyUntil ? at : bus->busyUntil;
+
+	/* 47 bits of overhead for a standard data frame, no bit stuffing */
+	if (bus->bitrate)
+		ready += (47 + 8 * (UNS64)m->len) * 1000000000ull / bus->bitrate;
+	bus->busyUntil = ready;
+
+	for(port = bus->ports ; port ; port = port->next)
+		if (port != from && port->open)
+			Sim_push(port, m, ready);
+	return ready;
+}
+
+/* Start the SDO answers ready by until, earliest first. A node still
+ * processing a request does not hold the wire meanwhile. */
+static void Sim_flush(SimBus* bus, UNS64 until)
+{
+	SimNode *node;
+	SimNode *first;
+	SimFrame *frame;
+	int i;
+
+	while (bus->pending)
+	{
+		first = NULL;
+		for(i = 1 ; i <= SIM_MAX_NODES ; i++)
+		{
+			node = bus->nodes[i];
+			if (node && node->outHead != node->outTail && (!first ||
+					node->outbox[node->outTail & (SIM_OUTBOX - 1)].ready <
+					first->outbox[first->outTail & (SIM_OUTBOX - 1)].ready))
+				first = node;
+		}
+		frame = &first->outbox[first->outTail & (SIM_OUTBOX - 1)];
+		if (frame->ready > until)
+			return;
+		Sim_place(bus, &frame->m, frame->ready, NULL);
+		first->outTail++;
+		bus->pending--;
+	}
+}
+
+/* Ready time of the next SDO answer, 0 if none */
+static UNS64 Sim_next_answer(SimBus* bus)
+{
+	SimNode *node;
+	UNS64 next = 0;
+	UNS64 ready;
+	int i;
+
+	for(i = 1 ; bus->pending && i <= SIM_MAX_NODES ; i++)
+	{
+		node = bus->nodes[i];
+		if (!node || node->outHead == node->outTail)
+			continue;
+		ready = node->outbox[node->outTail & (SIM_OUTBOX - 1)].ready;
+		if (!next || ready < next)
+			next = ready;
+	}
+	return next;
+}
+
+static UNS64 Sim_wire(SimBus* bus, const Message* m, UNS64 at, SimPort* from)
+{
+	Sim_flush(bus, at);
+	return Sim_place(bus, m, at, from);
+}
+
+static void Sim_send(SimBus* bus, UNS16 cob_id, UNS8 len, const UNS8* data, UNS64 at)
+{
+	Message m;
+
+	memset(&m, 0, sizeof(m));
+	m.cob_id = cob_id;
+	m.len = len;
+	if (data)
+		memcpy(m.data, data, len);
+	Sim_wire(bus, &m, at, NULL);
+}
+
+/* SDO answer of a node, on the wire once ready at at */
+static void Sim_reply(SimBus* bus, SimNode* node, const UNS8* data, UNS64 at)
+{
+	SimFrame *frame;
+	SimPort *port;
+
+	if (node->outHead - node->outTail == SIM_OUTBOX)
+	{
+		Sim_send(bus, 0x580 + node->id, 8, data, at);
+		return;
+	}
+	frame = &node->outbox[node->outHead & (SIM_OUTBOX - 1)];
+	memset(&frame->m, 0, sizeof(frame->m));
+	frame->m.cob_id = 0x580 + node->id;
+	frame->m.len = 8;
+	memcpy(frame->m.data, data, 8);
+	frame->ready = at;
+	node->outHead++;
+	bus->pending++;
+	/* Receive threads sleeping until their next frame wake up for it */
+	for(port = bus->ports ; port ; port = port->next)
+		if (port->open)
+			pthread_cond_signal(&port->cond);
+}
+
+/***************************  DICTIONARY  *****************************************/
+
+static SimObject* Sim_find(SimNode* node, UNS16 index, UNS8 subIndex)
+{
+	UNS32 i;
+
+	for(i = 0 ; i < node->count ; i++)
+		if (node->objects[i].index == index && node->objects[i].subIndex == subIndex)
+			return &node->objects[i];
+	return NULL;
+}
+
+static int Sim_has_index(SimNode* node, UNS16 index)
+{
+	UNS32 i;
+
+	for(i = 0 ; i < node->count ; i++)
+		if (node->objects[i].index == index)
+			return 1;
+	return 0;
+}
+
+static SimObject* Sim_store(SimNode* node, UNS16 index, UNS8 subIndex, const void* data, UNS32 size)
+{
+	SimObject *obj = Sim_find(node, index, subIndex);
+	UNS8 *copy = malloc(size ? size : 1);
+
+	if (!copy)
+		return NULL;
+	memcpy(copy, data, size);
+	if (!obj)
+	{
+		if (node->count == node->allocated)
+		{
+			UNS32 allocated = node->allocated ? node->allocated * 2 : 16;
+			SimObject *objects = realloc(node->objects, allocated * sizeof(SimObject));
+
+			if (!objects)
+			{
+				free(copy);
+				return NULL;
+			}
+			node->objects = objects;
+			node->allocated = allocated;
+		}
+		obj = &node->objects[node->count++];
+		obj->index = index;
+		obj->subIndex = subIndex;
+		obj->readOnly = 0;
+		obj->data = NULL;
+	}
+	free(obj->data);
+	obj->data = copy;
+	obj->size = size;
+	return obj;
+}
+
+static void Sim_store_u32(SimNode* node, UNS16 index, UNS8 subIndex, UNS32 value, UNS32 size, UNS8 readOnly)
+{
+	UNS8 le[4] = { value, value >> 8, value >> 16, value >> 24 };
+	SimObject *obj = Sim_store(node, index, subIndex, le, size);
+
+	if (obj)
+		obj->readOnly = readOnly;
+}
+
+/***************************  OS INTERPRETER  *****************************************/
+
+static void Sim_os_status(SimNode* node, UNS8 status)
+{
+	SimObject *obj = Sim_store(node, 0x1023, 0x02, &status, 1);
+
+	if (obj)
+		obj->readOnly = 1;
+}
+
+/* Command written to 0x1023:01 at time at */
+static UNS32 Sim_os_command(SimNode* node, UNS64 at)
+{
+	SimObject *reply = Sim_store(node, 0x1023, 0x03, "", 0);
+	long jitter = Sim_config("osjitter", 0);
+
+	if (!reply)
+		return 0x05040005;	/* SDOABT_OUT_OF_MEMORY */
+	reply->readOnly = 1;
+	Sim_os_status(node, SIM_OS_STATUS_BUSY);
+	node->osBusy = 1;
+	node->osDone = at + Sim_config("os", 0) * 1000ull;
+	if (jitter > 0)
+		node->osDone += (rand_r(&node->seed) % jitter) * 1000ull;
+	return 0;
+}
+
+/* Complete the command in progress once its latency has elapsed at time at.
+ * Returns an SDO abort code for reads of the reply while it is busy. */
+static UNS32 Sim_os_update(SimNode* node, UNS8 subIndex, UNS64 at)
+{
+	SimObject *command = Sim_find(node, 0x1023, 0x01);
+	SimObject *obj;
+	long size = Sim_config("reply", 4);
+	UNS8 *reply;
+	long i;
+
+	if (!node->osBusy)
+		return 0;
+	if (at < node->osDone)
+		return subIndex == 0x03 ? 0x08000022 : 0;	/* not in this device state */
+
+	node->osBusy = 0;
+	if (size <= 0 || !command || !command->size)
+	{
+		Sim_os_status(node, SIM_OS_STATUS_DONE);
+		return 0;
+	}
+	reply = malloc(size);
+	if (!reply)
+	{
+		Sim_os_status(node, SIM_OS_STATUS_ERROR);
+		return 0;
+	}
+	for(i = 0 ; i < size ; i++)
+		reply[i] = command->data[i % command->size];
+	obj = Sim_store(node, 0x1023, 0x03, reply, size);
+	free(reply);
+	if (obj)
+		obj->readOnly = 1;
+	Sim_os_status(node, obj ? SIM_OS_STATUS_REPLY : SIM_OS_STATUS_ERROR);
+	return 0;
+}
+
+/* Write access from the SDO server at time at, returns an SDO abort code or 0 */
+static UNS32 Sim_write(SimNode* node, UNS16 index, UNS8 subIndex, const UNS8* data, UNS32 size, UNS64 at)
+{
+	SimObject *obj = Sim_find(node, index, subIndex);
+
+	if (obj && obj->readOnly)
+		return 0x06010002;	/* OD_WRITE_NOT_ALLOWED */
+	if (!Sim_store(node, index, subIndex, data, size))
+		return 0x05040005;	/* SDOABT_OUT_OF_MEMORY */
+
+	if (index == 0x1017 && subIndex == 0)
+	{
+		node->heartbeat = data[0] | (size > 1 ? data[1] << 8 : 0);
+		node->nextHeartbeat = Sim_now() + node->heartbeat * 1000000ull;
+	}
+	else if (index == 0x1023 && subIndex == 0x01)
+		return Sim_os_command(node, at);
+	else if (index == 0x1024 && subIndex == 0 && size && data[0] == 3 && node->osBusy)
+	{
+		/* abort the command in progress */
+		node->osBusy = 0;
+		Sim_os_status(node, SIM_OS_STATUS_ERROR);
+	}
+	return 0;
+}
+
+/***************************  NODES  *****************************************/
+
+static SimNode* Sim_node_new(UNS8 id)
+{
+	SimNode *node = calloc(1, sizeof(SimNode));
+
+	if (!node)
+		return NULL;
+	node->id = id;
+	node->state = SIM_STATE_PREOP;
+	node->heartbeat = Sim_config("heartbeat", 0);
+	node->nextHeartbeat = Sim_now() + node->heartbeat * 1000000ull;
+
+	Sim_store_u32(node, 0x1000, 0x00, 0x00020192, 4, 1);	/* device type: drive profile */
+	Sim_store_u32(node, 0x1001, 0x00, 0, 1, 1);
+	Sim_store_u32(node, 0x1017, 0x00, node->heartbeat, 2, 0);
+	Sim_store_u32(node, 0x1018, 0x00, 4, 1, 1);
+	Sim_store_u32(node, 0x1018, 0x01, Sim_config("vendor", 0x9A), 4, 1);
+	Sim_store_u32(node, 0x1018, 0x02, Sim_config("product", 0x5348), 4, 1);
+	Sim_store_u32(node, 0x1018, 0x03, 0x00010000, 4, 1);
+	Sim_store_u32(node, 0x1018, 0x04, 0x1000 + id, 4, 1);
+	Sim_store_u32(node, 0x1023, 0x00, 3, 1, 1);
+	Sim_store(node, 0x1023, 0x01, "", 0);
+	Sim_os_status(node, SIM_OS_STATUS_DONE);
+	Sim_store_u32(node, 0x1023, 0x03, 0, 0, 1);
+	Sim_store_u32(node, 0x1024, 0x00, 0, 1, 0);
+	node->seed = id;
+	return node;
+}
+
+static void Sim_node_free(SimNode* node)
+{
+	UNS32 i;
+
+	for(i = 0 ; i < node->count ; i++)
+		free(node->objects[i].data);
+	free(node->objects);
+	free(node->buffer);
+	free(node);
+}
+
+static int Sim_reserve(SimNode* node, UNS32 size)
+{
+	UNS8 *buffer;
+
+	if (size <= node->capacity)
+		return 0;
+	buffer = realloc(node->buffer, size);
+	if (!buffer)
+		return -1;
+	node->buffer = buffer;
+	node->capacity = size;
+	return 0;
+}
+
+static void Sim_bootup(SimBus* bus, SimNode* node, UNS64 at)
+{
+	UNS8 state = SIM_STATE_BOOTUP;
+
+	node->sdoState = SIM_SDO_IDLE;
+	node->guardToggle = 0;
+	Sim_send(bus, 0x700 + node->id, 1, &state, at);
+	node->state = SIM_STATE_PREOP;
+}
+
+static void Sim_sdo_abort(SimBus* bus, SimNode* node, UNS16 index, UNS8 subIndex, UNS32 code, UNS64 at)
+{
+	UNS8 r[8] = { 0x80, index, index >> 8, subIndex, code, code >> 8, code >> 16, code >> 24 };
+
+	node->sdoState = SIM_SDO_IDLE;
+	Sim_reply(bus, node, r, at);
+}
+
+/* Block upload: send the next block of segments */
+static void Sim_block_send(SimBus* bus, SimNode* node, UNS64 at)
+{
+	UNS8 r[8];
+	UNS32 n;
+	UNS8 seq = 1;
+
+	node->blockStart = node->offset;
+	do {
+		n = node->size - node->offset;
+		if (n > 7)
+			n = 7;
+		memset(r, 0, sizeof(r));
+		r[0] = seq;
+		memcpy(r + 1, node->buffer + node->offset, n);
+		node->offset += n;
+		if (node->offset == node->size)
+			r[0] |= 0x80;
+		Sim_reply(bus, node, r, at);
+	} while (node->offset < node->size && seq++ < node->blockSize);
+}
+
+/* Block download: one segment of a block */
+static void Sim_block_segment(SimBus* bus, SimNode* node, const UNS8* d, UNS64 at)
+{
+	UNS8 r[8] = { 0xA2, 0, 0, 0, 0, 0, 0, 0 };
+	UNS8 seq = d[0] & 0x7F;
+
+	if (seq == node->sequence + 1)
+	{
+		if (Sim_reserve(node, node->offset + 7))
+		{
+			Sim_sdo_abort(bus, node, node->index, node->subIndex, 0x05040005, at);
+			return;
+		}
+		memcpy(node->buffer + node->offset, d + 1, 7);
+		node->offset += 7;
+		node->sequence = seq;
+		if (d[0] & 0x80)
+			node->last = 1;
+	}
+	if (seq == node->blockSize || (d[0] & 0x80))
+	{
+		/* acknowledge the block up to the last segment in sequence */
+		r[1] = node->sequence;
+		r[2] = node->blockSize;
+		node->sequence = 0;
+		if (node->last)
+			node->sdoState = SIM_SDO_BLOCK_DOWNLOAD_END;
+		Sim_reply(bus, node, r, at);
+	}
+}
+
+/* SDO server, one client request */
+static void Sim_sdo(SimBus* bus, SimNode* node, const UNS8* d, UNS64 at)
+{
+	UNS8 r[8];
+	UNS16 index = d[1] | d[2] << 8;
+	UNS8 subIndex = d[3];
+	SimObject *obj;
+	UNS32 code;
+	UNS32 n;
+
+	/* Answers leave in order, each after the processing time */
+	at += bus->response;
+	if (at < node->ready)
+		at = node->ready;
+	node->ready = at;
+	memset(r, 0, sizeof(r));
+
+	if (node->sdoState == SIM_SDO_BLOCK_DOWNLOAD)
+	{
+		if (d[0] == 0x80)
+			node->sdoState = SIM_SDO_IDLE;	/* abort from the client */
+		else
+			Sim_block_segment(bus, node, d, at);
+		return;
+	}
+
+	switch(d[0] >> 5)
+	{
+		case 1: /* initiate download */
+			node->index = index;
+			node->subIndex = subIndex;
+			if (d[0] & 0x02)
+			{
+				/* expedited */
+				n = (d[0] & 0x01) ? 4 - ((d[0] >> 2) & 0x03) : 4;
+				node->sdoState = SIM_SDO_IDLE;
+				code = Sim_write(node, index, subIndex, d + 4, n, at);
+				if (code)
+				{
+					Sim_sdo_abort(bus, node, index, subIndex, code, at);
+					return;
+				}
+			}
+			else
+			{
+				node->size = (d[0] & 0x01) ? (UNS32)(d[4] | d[5] << 8 | d[6] << 16 | d[7] << 24) : 0;
+				if (Sim_reserve(node, node->size))
+				{
+					Sim_sdo_abort(bus, node, index, subIndex, 0x05040005, at);
+					return;
+				}
+				node->offset = 0;
+				node->toggle = 0;
+				node->sdoState = SIM_SDO_DOWNLOAD;
+			}
+			r[0] = 0x60;
+			memcpy(r + 1, d + 1, 3);
+			break;
+
+		case 0: /* download segment */
+			if (node->sdoState != SIM_SDO_DOWNLOAD)
+			{
+				Sim_sdo_abort(bus, node, node->index, node->subIndex, 0x05040001, at);
+				return;
+			}
+			if (((d[0] >> 4) & 0x01) != node->toggle)
+			{
+				Sim_sdo_abort(bus, node, node->index, node->subIndex, 0x05030000, at);
+				return;
+			}
+			n = 7 - ((d[0] >> 1) & 0x07);
+			if (Sim_reserve(node, node->offset + n))
+			{
+				Sim_sdo_abort(bus, node, node->index, node->subIndex, 0x05040005, at);
+				return;
+			}
+			memcpy(node->buffer + node->offset, d + 1, n);
+			node->offset += n;
+			r[0] = 0x20 | node->toggle << 4;
+			node->toggle ^= 1;
+			if (d[0] & 0x01)
+			{
+				node->sdoState = SIM_SDO_IDLE;
+				code = Sim_write(node, node->index, node->subIndex, node->buffer, node->offset, at);
+				if (code)
+				{
+					Sim_sdo_abort(bus, node, node->index, node->subIndex, code, at);
+					return;
+				}
+			}
+			break;
+
+		case 2: /* initiate upload */
+			node->sdoState = SIM_SDO_IDLE;
+			code = index == 0x1023 ? Sim_os_update(node, subIndex, at) : 0;
+			if (code)
+			{
+				Sim_sdo_abort(bus, node, index, subIndex, code, at);
+				return;
+			}
+			obj = Sim_find(node, index, subIndex);
+			if (!obj)
+			{
+				Sim_sdo_abort(bus, node, index, subIndex,
+						Sim_has_index(node, index) ? 0x06090011 : 0x06020000, at);
+				return;
+			}
+			memcpy(r + 1, d + 1, 3);
+			/* expedited cannot say 0 bytes: empty objects go segmented */
+			if (obj->size && obj->size <= 4)
+			{
+				r[0] = 0x43 | (4 - obj->size) << 2;
+				memcpy(r + 4, obj->data, obj->size);
+			}
+			else
+			{
+				if (Sim_reserve(node, obj->size))
+				{
+					Sim_sdo_abort(bus, node, index, subIndex, 0x05040005, at);
+					return;
+				}
+				memcpy(node->buffer, obj->data, obj->size);
+				node->index = index;
+				node->subIndex = subIndex;
+				node->size = obj->size;
+				node->offset = 0;
+				node->toggle = 0;
+				node->sdoState = SIM_SDO_UPLOAD;
+				r[0] = 0x41;
+				r[4] = obj->size;
+				r[5] = obj->size >> 8;
+				r[6] = obj->size >> 16;
+				r[7] = obj->size >> 24;
+			}
+			break;
+
+		case 3: /* upload segment */
+			if (node->sdoState != SIM_SDO_UPLOAD)
+			{
+				Sim_sdo_abort(bus, node, node->index, node->subIndex, 0x05040001, at);
+				return;
+			}
+			if (((d[0] >> 4) & 0x01) != node->toggle)
+			{
+				Sim_sdo_abort(bus, node, node->index, node->subIndex, 0x05030000, at);
+				return;
+			}
+			n = node->size - node->offset;
+			if (n > 7)
+				n = 7;
+			r[0] = node->toggle << 4 | (7 - n) << 1;
+			memcpy(r + 1, node->buffer + node->offset, n);
+			node->offset += n;
+			node->toggle ^= 1;
+			if (node->offset == node->size)
+			{
+				r[0] |= 0x01;
+				node->sdoState = SIM_SDO_IDLE;
+			}
+			break;
+
+		case 5: /* block upload */
+			switch(d[0] & 0x03)
+			{
+				case 0: /* initiate */
+					node->sdoState = SIM_SDO_IDLE;
+					obj = Sim_find(node, index, subIndex);
+					if (!obj)
+					{
+						Sim_sdo_abort(bus, node, index, subIndex,
+								Sim_has_index(node, index) ? 0x06090011 : 0x06020000, at);
+						return;
+					}
+					if (d[4] == 0 || d[4] > 127)
+					{
+						Sim_sdo_abort(bus, node, index, subIndex, 0x05040002, at);
+						return;
+					}
+					if (Sim_reserve(node, obj->size))
+					{
+						Sim_sdo_abort(bus, node, index, subIndex, 0x05040005, at);
+						return;
+					}
+					memcpy(node->buffer, obj->data, obj->size);
+					node->index = index;
+					node->subIndex = subIndex;
+					node->size = obj->size;
+					node->offset = 0;
+					node->blockSize = d[4];
+					node->sdoState = SIM_SDO_BLOCK_UPLOAD;
+					r[0] = 0xC2;
+					memcpy(r + 1, d + 1, 3);
+					r[4] = obj->size;
+					r[5] = obj->size >> 8;
+					r[6] = obj->size >> 16;
+					r[7] = obj->size >> 24;
+					break;
+
+				case 3: /* start */
+					if (node->sdoState != SIM_SDO_BLOCK_UPLOAD)
+					{
+						Sim_sdo_abort(bus, node, node->index, node->subIndex, 0x05040001, at);
+						return;
+					}
+					Sim_block_send(bus, node, at);
+					return;
+
+				case 2: /* block acknowledge */
+					if (node->sdoState != SIM_SDO_BLOCK_UPLOAD)
+					{
+						Sim_sdo_abort(bus, node, node->index, node->subIndex, 0x05040001, at);
+						return;
+					}
+					node->offset = node->blockStart + d[1] * 7;
+					if (node->offset < node->size)
+					{
+						if (d[2] == 0 || d[2] > 127)
+						{
+							Sim_sdo_abort(bus, node, node->index, node->subIndex, 0x05040002, at);
+							return;
+						}
+						node->blockSize = d[2];
+						Sim_block_send(bus, node, at);
+						return;
+					}
+					/* end, with the number of unused bytes of the last segment */
+					node->offset = node->size;
+					r[0] = 0xC1 | ((7 - node->size % 7) % 7) << 2;
+					break;
+
+				case 1: /* end acknowledge */
+					node->sdoState = SIM_SDO_IDLE;
+					return;
+			}
+			break;
+
+		case 6: /* block download */
+			if ((d[0] & 0x01) == 0)
+			{
+				/* initiate */
+				node->index = index;
+				node->subIndex = subIndex;
+				node->size = (d[0] & 0x02) ? (UNS32)(d[4] | d[5] << 8 | d[6] << 16 | d[7] << 24) : 0;
+				if (Sim_reserve(node, node->size))
+				{
+					Sim_sdo_abort(bus, node, index, subIndex, 0x05040005, at);
+					return;
+				}
+				node->offset = 0;
+				node->sequence = 0;
+				node->last = 0;
+				node->blockSize = Sim_config("blksize", SIM_BLOCK_SIZE);
+				node->sdoState = SIM_SDO_BLOCK_DOWNLOAD;
+				r[0] = 0xA0;
+				memcpy(r + 1, d + 1, 3);
+				r[4] = node->blockSize;
+				break;
+			}
+			/* end, with the number of unused bytes of the last segment */
+			if (node->sdoState != SIM_SDO_BLOCK_DOWNLOAD_END)
+			{
+				Sim_sdo_abort(bus, node, node->index, node->subIndex, 0x05040001, at);
+				return;
+			}
+			node->sdoState = SIM_SDO_IDLE;
+			n = (d[0] >> 2) & 0x07;
+			code = Sim_write(node, node->index, node->subIndex, node->buffer,
+					node->offset > n ? node->offset - n : 0, at);
+			if (code)
+			{
+				Sim_sdo_abort(bus, node, node->index, node->subIndex, code, at);
+				return;
+			}
+			r[0] = 0xA1;
+			break;
+
+		case 4: /* abort from the client */
+			node->sdoState = SIM_SDO_IDLE;
+			return;
+
+		default:
+			Sim_sdo_abort(bus, node, index, subIndex, 0x05040001, at);
+			return;
+	}
+	Sim_reply(bus, node, r, at);
+}
+
+static void Sim_nmt(SimBus* bus, SimNode* node, UNS8 cs, UNS64 at)
+{
+	switch(cs)
+	{
+		case 0x01: node->state = SIM_STATE_OPERATIONAL; break;
+		case 0x02: node->state = SIM_STATE_STOPPED; break;
+		case 0x80: node->state = SIM_STATE_PREOP; break;
+		case 0x81: /* reset node */
+		case 0x82: /* reset communication */
+			Sim_bootup(bus, node, at);
+			break;
+	}
+}
+
+/* A frame sent by a port reached the simulated nodes at time at */
+static void Sim_receive(SimBus* bus, const Message* m, UNS64 at)
+{
+	SimNode *node;
+	UNS8 state;
+	int i;
+
+	if (m->cob_id == 0x000 && m->len >= 2)
+	{
+		for(i = 1 ; i <= SIM_MAX_NODES ; i++)
+			if (bus->nodes[i] && (m->data[1] == 0 || m->data[1] == i))
+				Sim_nmt(bus, bus->nodes[i], m->data[0], at);
+		return;
+	}
+
+	node = bus->nodes[m->cob_id & 0x7F];
+	if (!node)
+		return;
+
+	switch(m->cob_id & 0x780)
+	{
+		case 0x600:
+			if (!m->rtr && m->len == 8 && node->state != SIM_STATE_STOPPED)
+				Sim_sdo(bus, node, m->data, at);
+			break;
+		case 0x700:
+			/* node guarding */
+			if (m->rtr)
+			{
+				state = node->state | node->guardToggle << 7;
+				node->guardToggle ^= 1;
+				Sim_send(bus, 0x700 + node->id, 1, &state, at);
+			}
+			break;
+	}
+}
+
+/* Produce the SDO answers and heartbeats due at now, returns the time of
+ * the next one */
+static UNS64 Sim_tick(SimBus* bus, UNS64 now)
+{
+	UNS64 next;
+	SimNode *node;
+	int i;
+
+	Sim_flush(bus, now);
+	next = Sim_next_answer(bus);
+
+	for(i = 1 ; i <= SIM_MAX_NODES ; i++)
+	{
+		node = bus->nodes[i];
+		if (!node || !node->heartbeat)
+			continue;
+		if (node->nextHeartbeat <= now)
+		{
+			Sim_send(bus, 0x700 + node->id, 1, &node->state, node->nextHeartbeat);
+			node->nextHeartbeat += node->heartbeat * 1000000ull;
+			if (node->nextHeartbeat <= now)
+				node->nextHeartbeat = now + node->heartbeat * 1000000ull;
+		}
+		if (!next || node->nextHeartbeat < next)
+			next = node->nextHeartbeat;
+	}
+	return next;
+}
+
+/* Create the nodes of a list such as "01-05,0a" */
+static void Sim_add_nodes(SimBus* bus, const char* list, UNS64 now)
+{
+	unsigned int first;
+	unsigned int last;
+	unsigned int id;
+	int used;
+
+	while (list && *list)
+	{
+		if (sscanf(list, "%x-%x%n", &first, &last, &used) != 2)
+		{
+			if (sscanf(list, "%x%n", &first, &used) != 1)
+				return;
+			last = first;
+		}
+		for(id = first ; id <= last && id <= SIM_MAX_NODES ; id++)
+		{
+			if (id == 0 || bus->nodes[id])
+				continue;
+			bus->nodes[id] = Sim_node_new(id);
+			if (bus->nodes[id])
+				Sim_bootup(bus, bus->nodes[id], now);
+		}
+		list += used;
+		if (*list == ',')
+			list++;
+	}
+}
+
+/* Unlink a closed port, and its bus once no port is left */
+static void Sim_release(SimPort* port)
+{
+	SimBus *bus = port->bus;
+	SimPort **p;
+	SimBus **b;
+	int i;
+
+	pthread_mutex_lock(&Sim_buses_lock);
+	pthread_mutex_lock(&bus->lock);
+	for(p = &bus->ports ; *p ; p = &(*p)->next)
+		if (*p == port)
+		{
+			*p = port->next;
+			break;
+		}
+	pthread_mutex_unlock(&bus->lock);
+	pthread_cond_destroy(&port->cond);
+	free(port);
+
+	if (!bus->ports)
+	{
+		for(b = &Sim_buses ; *b ; b = &(*b)->next)
+			if (*b == bus)
+			{
+				*b = bus->next;
+				break;
+			}
+		for(i = 1 ; i <= SIM_MAX_NODES ; i++)
+			if (bus->nodes[i])
+				Sim_node_free(bus->nodes[i]);
+		pthread_mutex_destroy(&bus->lock);
+		free(bus);
+	}
+	pthread_mutex_unlock(&Sim_buses_lock);
+}
+
+/***************************  DRIVER INTERFACE  *****************************************/
+
+UNS8 canReceive_driver(CAN_HANDLE fd0, Message *m)
+{
+	SimPort *port = (SimPort*)fd0;
+	SimBus *bus = port->bus;
+	struct timespec ts;
+	UNS64 now;
+	UNS64 wake;
+	SimFrame *frame;
+
+	pthread_mutex_lock(&bus->lock);
+	for(;;)
+	{
+		if (!port->open)
+		{
+			pthread_mutex_unlock(&bus->lock);
+			Sim_release(port);
+			return 1;
+		}
+		now = Sim_now();
+		wake = Sim_tick(bus, now);
+		if (port->head != port->tail)
+		{
+			frame = &port->queue[port->tail & (SIM_QUEUE - 1)];
+			if (frame->ready <= now)
+			{
+				*m = frame->m;
+				port->tail++;
+				pthread_mutex_unlock(&bus->lock);
+				return 0;
+			}
+			if (!wake || frame->ready < wake)
+				wake = frame->ready;
+		}
+		if (wake)
+		{
+			ts.tv_sec = wake / 1000000000ull;
+			ts.tv_nsec = wake % 1000000000ull;
+			pthread_cond_timedwait(&port->cond, &bus->lock, &ts);
+		}
+		else
+			pthread_cond_wait(&port->cond, &bus->lock);
+	}
+}
+
+UNS8 canSend_driver(CAN_HANDLE fd0, Message const *m)
+{
+	SimPort *port = (SimPort*)fd0;
+	SimBus *bus = port->bus;
+	UNS64 at;
+
+	pthread_mutex_lock(&bus->lock);
+	at = Sim_wire(bus, m, Sim_now(), port);
+	Sim_receive(bus, m, at);
+	pthread_mutex_unlock(&bus->lock);
+	return 0;
+}
+
+UNS8 canChangeBaudRate_driver(CAN_HANDLE fd0, char* baud)
+{
+	SimPort *port = (SimPort*)fd0;
+
+	pthread_mutex_lock(&port->bus->lock);
+	port->bus->bitrate = Sim_bitrate(baud);
+	pthread_mutex_unlock(&port->bus->lock);
+	return 0;
+}
+
+CAN_HANDLE canOpen_driver(s_BOARD *board)
+{
+	const char *nodes = strchr(board->busname, ':');
+	size_t len = nodes ? (size_t)(nodes - board->busname) : strlen(board->busname);
+	pthread_condattr_t attr;
+	SimPort *port;
+	SimBus *bus;
+
+	if (len >= sizeof(bus->name))
+		return NULL;
+	port = calloc(1, sizeof(SimPort));
+	if (!port)
+		return NULL;
+
+	pthread_mutex_lock(&Sim_buses_lock);
+	for(bus = Sim_buses ; bus ; bus = bus->next)
+		if (strlen(bus->name) == len && strncmp(bus->name, board->busname, len) == 0)
+			break;
+	if (!bus)
+	{
+		bus = calloc(1, sizeof(SimBus));
+		if (!bus)
+		{
+			pthread_mutex_unlock(&Sim_buses_lock);
+			free(port);
+			return NULL;
+		}
+		memcpy(bus->name, board->busname, len);
+		pthread_mutex_init(&bus->lock, NULL);
+		bus->bitrate = Sim_bitrate(board->baudrate);
+		bus->response = Sim_config("response", 0) * 1000;
+		bus->next = Sim_buses;
+		Sim_buses = bus;
+	}
+
+	pthread_condattr_init(&attr);
+	pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+	pthread_cond_init(&port->cond, &attr);
+	pthread_condattr_destroy(&attr);
+	port->bus = bus;
+	port->open = 1;
+
+	pthread_mutex_lock(&bus->lock);
+	port->next = bus->ports;
+	bus->ports = port;
+	if (nodes)
+		Sim_add_nodes(bus, nodes + 1, Sim_now());
+	pthread_mutex_unlock(&bus->lock);
+	pthread_mutex_unlock(&Sim_buses_lock);
+	return port;
+}
+
+int canClose_driver(CAN_HANDLE fd0)
+{
+	SimPort *port = (SimPort*)fd0;
+	SimBus *bus = port->bus;
+
+	/* The receive thread, joined after this returns, releases the port */
+	pthread_mutex_lock(&bus->lock);
+	port->open = 0;
+	pthread_cond_broadcast(&port->cond);
+	pthread_mutex_unlock(&bus->lock);
+	return 0;
+}
@@ -0,0 +1,280 @@
+/*
+This file is part of CanFestival, a library implementing CanOpen Stack.
+
+Copyright (C): Edouard TISSERANT and Francis DUPIN
+
+See COPYING file for copyrights details.
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "CANOpenShellTiming.h"
+#include "CANOpenShellCapture.h"
+#include "CANOpenShellSDO.h"
+
+/* Histograms of the SYNC period error and of the delay between a SYNC
+ * and each RPDO, per sending node (COB-ID & 0x7F). Updated from the CAN
+ * hooks, read under the stack mutex. */
+typedef struct {
+	UNS64 firstSync;	/* ns */
+	UNS64 lastSync;		/* ns, 0 before the first SYNC */
+	UNS32 period;		/* us, 0x1006 at the last SYNC */
+	UNS32 syncs;
+	UNS32 missed;		/* periods without SYNC */
+	Timing_histogram jitter;
+	Timing_histogram latency[MAX_NODES + 1];
+} Timing_data;
+
+static Timing_data Timing;
+static UNS32 Timing_cobs[CAPTURE_COB_WORDS];
+static int Timing_on;
+
+static void Timing_reset(Timing_histogram* h, INTEGER32 origin, UNS32 width)
+{
+	memset(h, 0, sizeof(*h));
+	h->origin = origin;
+	h->width = width;
+}
+
+static void Timing_add(Timing_histogram* h, INTEGER32 us)
+{
+	INTEGER32 bin = us - h->origin;
+
+	if (bin < 0)
+		h->under++;
+	else if (bin / h->width >= TIMING_BINS)
+		h->over++;
+	else
+		h->bins[bin / h->width]++;
+	if (!h->count || us < h->min)
+		h->min = us;
+	if (!h->count || us > h->max)
+		h->max = us;
+	h->count++;
+	h->sum += us;
+	h->sumsq += (double)us * us;
+}
+
+/* Upper bound of the bin holding the given fraction of the samples */
+static INTEGER32 Timing_percentile(const Timing_histogram* h, double fraction)
+{
+	UNS32 rank = (UNS32)(fraction * h->count);
+	UNS32 seen = h->under;
+	int i;
+
+	if (rank < seen)
+		return h->min;
+	for(i = 0 ; i < TIMING_BINS ; i++)
+	{
+		seen += h->bins[i];
+		if (rank < seen)
+			return h->origin + (INTEGER32)((i + 1) * h->width);
+	}
+	return h->max;
+}
+
+static void Timing_reset_sync(void)
+{
+	Timing.firstSync = 0;
+	Timing.lastSync = 0;
+	Timing.period = 0;
+	Timing.syncs = 0;
+	Timing.missed = 0;
+	Timing_reset(&Timing.jitter, -(TIMING_BINS / 2) * TIMING_JITTER_BIN_US, TIMING_JITTER_BIN_US);
+}
+
+void Timing_start(CO_Data* d)
+{
+	int i;
+
+	Capture_rpdo_cobs(d, Timing_cobs);
+	Timing_reset_sync();
+	for(i = 0 ; i <= MAX_NODES ; i++)
+		Timing_reset(&Timing.latency[i], 0, TIMING_LATENCY_BIN_US);
+	Timing_on = 1;
+}
+
+void Timing_stop(void)
+{
+	Timing_on = 0;
+}
+
+int Timing_running(void)
+{
+	return Timing_on;
+}
+
+void Timing_frame(CO_Data* d, const Message* m, UNS64 timestamp)
+{
+	UNS16 cob = m->cob_id & 0x7FF;
+
+	if (!Timing_on || m->rtr)
+		return;
+
+	if (d->COB_ID_Sync && cob == (*d->COB_ID_Sync & 0x7FF))
+	{
+		if (Timing.lastSync && Timing.period)
+		{
+			UNS64 gap = (timestamp - Timing.lastSync) / 1000;
+			/* Number of periods the gap spans, rounded */
+			UNS64 cycles = (gap + Timing.period / 2) / Timing.period;
+
+			Timing_add(&Timing.jitter, (INTEGER32)gap - (INTEGER32)Timing.period);
+			if (cycles > 1)
+				Timing.missed += cycles - 1;
+		}
+		else
+			Timing.firstSync = timestamp;
+		Timing.lastSync = timestamp;
+		Timing.period = d->Sync_Cycle_Period ? *d->Sync_Cycle_Period : 0;
+		Timing.syncs++;
+	}
+	else if (Timing.lastSync && (Timing_cobs[cob >> 5] & (1u << (cob & 0x1F))))
+		Timing_add(&Timing.latency[cob & 0x7F], (INTEGER32)((timestamp - Timing.lastSync) / 1000));
+}
+
+/* Copy of the histograms taken under the stack mutex */
+static Timing_data* Timing_snapshot(void)
+{
+	Timing_data *copy = malloc(sizeof(Timing_data));
+
+	if (!copy)
+		return NULL;
+	EnterMutex();
+	*copy = Timing;
+	LeaveMutex();
+	return copy;
+}
+
+static double Timing_mean(const Timing_histogram* h)
+{
+	return h->count ? h->sum / h->count : 0;
+}
+
+static double Timing_stddev(const Timing_histogram* h)
+{
+	double mean = Timing_mean(h);
+
+	return h->count ? sqrt(h->sumsq / h->count - mean * mean) : 0;
+}
+
+static void Timing_print_data(FILE* out, const Timing_data* t)
+{
+	const Timing_histogram *h = &t->jitter;
+
+	fprintf(out, "SYNC: %u sent or received, period %u us", t->syncs, t->period);
+	if (t->syncs > 1)
+		fprintf(out, ", achieved %.1f Hz, %u missed",
+				(t->syncs - 1) * 1e9 / (t->lastSync - t->firstSync), t->missed);
+	fprintf(out, "\n");
+	if (h->count)
+		fprintf(out, "  period error (us): min %d p50 %d p99 %d max %d mean %.1f stddev %.1f\n",
+				h->min, Timing_percentile(h, 0.5), Timing_percentile(h, 0.99), h->max,
+				Timing_mean(h), Timing_stddev(h));
+}
+
+void Timing_print_sync(FILE* out)
+{
+	Timing_data *t = Timing_snapshot();
+
+	if (!t)
+		return;
+	Timing_print_data(out, t);
+	free(t);
+}
+
+void Timing_print(FILE* out)
+{
+	Timing_data *t = Timing_snapshot();
+	Timing_histogram *h;
+	int i;
+
+	if (!t)
+		return;
+	Timing_print_data(out, t);
+	fprintf(out, "RPDO after SYNC (us):\n");
+	fprintf(out, "  node    count      min      p50      p99      max     mean   stddev\n");
+	for(i = 0 ; i <= MAX_NODES ; i++)
+	{
+		h = &t->latency[i];
+		if (h->count)
+			fprintf(out, "  %4.2x %8u %8d %8d %8d %8d %8.1f %8.1f\n", i, h->count,
+					h->min, Timing_percentile(h, 0.5), Timing_percentile(h, 0.99), h->max,
+					Timing_mean(h), Timing_stddev(h));
+	}
+	free(t);
+}
+
+static void Timing_write(FILE* out, const char* name, int node, const Timing_histogram* h)
+{
+	int i;
+
+	if (!h->count)
+		return;
+	if (h->under)
+		fprintf(out, "%s\t%d\t<%d\t%u\n", name, node, h->origin, h->under);
+	for(i = 0 ; i < TIMING_BINS ; i++)
+		if (h->bins[i])
+			fprintf(out, "%s\t%d\t%d\t%u\n", name, node, h->origin + (INTEGER32)(i * h->width), h->bins[i]);
+	if (h->over)
+		fprintf(out, "%s\t%d\t>=%d\t%u\n", name, node, h->origin + (INTEGER32)(TIMING_BINS * h->width), h->over);
+}
+
+/* One line per non-empty bin: histogram, node, lower bound (us), count */
+int Timing_export(const char* path)
+{
+	Timing_data *t = Timing_snapshot();
+	FILE *out;
+	int i;
+
+	if (!t)
+		return -1;
+	out = fopen(path, "w");
+	if (!out)
+	{
+		free(t);
+		return -1;
+	}
+	fprintf(out, "# histogram\tnode\tbin_us\tcount\n");
+	Timing_write(out, "sync_error", 0, &t->jitter);
+	for(i = 0 ; i <= MAX_NODES ; i++)
+		Timing_write(out, "rpdo_delay", i, &t->latency[i]);
+	fclose(out);
+	free(t);
+	return 0;
+}
+
+int Timing_sync_period(CO_Data* d, UNS32 period)
+{
+	UNS32 size = sizeof(period);
+
+	if (!d->COB_ID_Sync || !(*d->COB_ID_Sync & 0x40000000))
+		return -1;	/* not the SYNC producer */
+	if (writeLocalDict(d, 0x1006, 0x00, &period, &size, 0) != OD_SUCCESSFUL)
+		return -1;
+	/* Re-arm the SYNC alarm with the new period */
+	stopSYNC(d);
+	startSYNC(d);
+	if (Timing_on)
+		Timing_reset_sync();
+	else
+		Timing_start(d);
+	return 0;
+}
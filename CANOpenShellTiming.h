@@ -0,0 +1,68 @@
+/*
+This file is part of CanFestival, a library implementing CanOpen Stack.
+
+Copyright (C): Edouard TISSERANT and Francis DUPIN
+
+See COPYING file for copyrights details.
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+
+
+#ifndef CANOPENSHELLTIMING_H
+#define CANOPENSHELLTIMING_H
+
+#include <stdio.h>
+
+#include "canfestival.h"
+
+#define TIMING_BINS 200
+#define TIMING_JITTER_BIN_US 10		/* SYNC period error, bins centred on 0 */
+#define TIMING_LATENCY_BIN_US 25	/* SYNC to RPDO delay, bins from 0 */
+
+typedef struct {
+	INTEGER32 origin;	/* us, lower bound of bins[0] */
+	UNS32 width;		/* us per bin */
+	UNS32 bins[TIMING_BINS];
+	UNS32 under;		/* samples below origin */
+	UNS32 over;		/* samples past the last bin */
+	UNS32 count;
+	INTEGER32 min;
+	INTEGER32 max;
+	double sum;
+	double sumsq;
+} Timing_histogram;
+
+/* Reset the histograms and start timing the SYNC sent or received by d
+ * and the RPDOs it receives. Stack mutex held. */
+void Timing_start(CO_Data* d);
+void Timing_stop(void);
+int Timing_running(void);
+
+/* Called for every frame sent and received, stack mutex held */
+void Timing_frame(CO_Data* d, const Message* m, UNS64 timestamp);
+
+/* Print a summary or write every histogram bin to path. Stack mutex NOT
+ * held. */
+void Timing_print(FILE* out);
+void Timing_print_sync(FILE* out);
+int Timing_export(const char* path);
+
+/* Change the SYNC period (0x1006, us) of the SYNC producer d, re-arm the
+ * SYNC alarm and restart the SYNC statistics. A SYNC more than half a
+ * period late counts as a missed cycle. Stack mutex held. */
+int Timing_sync_period(CO_Data* d, UNS32 period);
+
+#endif // CANOPENSHELLTIMING_H
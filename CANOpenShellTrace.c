@@ -0,0 +1,222 @@
+/*
+This file is part of CanFestival, a library implementing CanOpen Stack.
+
+Copyright (C): Edouard TISSERANT and Francis DUPIN
+
+See COPYING file for copyrights details.
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <errno.h>
+
+#include "CANOpenShellTrace.h"
+#include "CANOpenShellSDO.h"
+
+#define TRACE_CHUNK 65536	/* records added to the file at a time */
+
+static int Trace_fd = -1;
+static Trace_header *Trace_map;
+static size_t Trace_size;	/* bytes mapped */
+static UNS64 Trace_capacity;	/* records that fit in the mapping */
+
+static size_t Trace_bytes(UNS64 records)
+{
+	return sizeof(Trace_header) + records * sizeof(Trace_record);
+}
+
+/* Extend the file and the mapping by one chunk */
+static int Trace_grow(void)
+{
+	size_t size = Trace_bytes(Trace_capacity + TRACE_CHUNK);
+	void *map;
+
+	if (ftruncate(Trace_fd, size) != 0)
+		return -1;
+	if (Trace_map)
+		map = mremap(Trace_map, Trace_size, size, MREMAP_MAYMOVE);
+	else
+		map = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, Trace_fd, 0);
+	if (map == MAP_FAILED)
+		return -1;
+	Trace_map = map;
+	Trace_size = size;
+	Trace_capacity += TRACE_CHUNK;
+	return 0;
+}
+
+int Trace_start(const char* path)
+{
+	struct timespec ts;
+
+	if (Trace_fd != -1)
+		return -1;
+	Trace_fd = open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+	if (Trace_fd == -1)
+		return -1;
+	Trace_map = NULL;
+	Trace_size = 0;
+	Trace_capacity = 0;
+
+	EnterMutex();
+	if (Trace_grow() != 0)
+	{
+		LeaveMutex();
+		close(Trace_fd);
+		Trace_fd = -1;
+		return -1;
+	}
+	clock_gettime(CLOCK_REALTIME, &ts);
+	memcpy(Trace_map->magic, TRACE_MAGIC, 8);
+	Trace_map->version = TRACE_VERSION;
+	Trace_map->recordSize = sizeof(Trace_record);
+	Trace_map->count = 0;
+	Trace_map->start = (UNS64)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+	LeaveMutex();
+	return 0;
+}
+
+void Trace_frame(CO_Data* d, const Message* m, UNS64 timestamp, UNS8 flags)
+{
+	Trace_record *rec;
+
+	if (!Trace_map)
+		return;
+	if (Trace_map->count == Trace_capacity && Trace_grow() != 0)
+		return;
+
+	rec = (Trace_record*)(Trace_map + 1) + Trace_map->count;
+	rec->timestamp = timestamp;
+	rec->cob_id = m->cob_id;
+	rec->len = m->len;
+	rec->flags = flags | (m->rtr ? TRACE_RTR : 0);
+	rec->nodeState = (UNS8)d->nodeState;
+	memcpy(rec->data, m->data, 8);
+	Trace_map->count++;
+}
+
+void Trace_stop(void)
+{
+	UNS64 count;
+
+	if (Trace_fd == -1)
+		return;
+	EnterMutex();
+	count = Trace_map->count;
+	munmap(Trace_map, Trace_size);
+	Trace_map = NULL;
+	LeaveMutex();
+
+	/* Drop the unused end of the last chunk */
+	if (ftruncate(Trace_fd, Trace_bytes(count)) != 0)
+		perror("ftruncate");
+	close(Trace_fd);
+	Trace_fd = -1;
+}
+
+int Trace_running(void)
+{
+	return Trace_map != NULL;
+}
+
+UNS64 Trace_count(void)
+{
+	return Trace_map ? Trace_map->count : 0;
+}
+
+int Trace_replay(CO_Data* d, const char* path, double speed, Trace_replay_stats* stats)
+{
+	const Trace_header *header;
+	const Trace_record *rec;
+	struct timespec ts;
+	struct stat st;
+	Message m;
+	UNS64 i;
+	UNS64 first = 0;
+	UNS64 start;
+	UNS64 due;
+	UNS64 now;
+	int fd;
+
+	memset(stats, 0, sizeof(*stats));
+	fd = open(path, O_RDONLY);
+	if (fd == -1)
+		return -1;
+	if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(Trace_header))
+	{
+		close(fd);
+		return -1;
+	}
+	header = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (header == MAP_FAILED)
+		return -1;
+	if (memcmp(header->magic, TRACE_MAGIC, 8) || header->version != TRACE_VERSION ||
+			header->recordSize != sizeof(Trace_record) ||
+			Trace_bytes(header->count) > (size_t)st.st_size)
+	{
+		munmap((void*)header, st.st_size);
+		return -1;
+	}
+
+	rec = (const Trace_record*)(header + 1);
+	start = SDO_now();
+	for(i = 0 ; i < header->count ; i++, rec++)
+	{
+		/* Frames this node sent are produced again by the stack itself */
+		if (rec->flags & TRACE_TX)
+			continue;
+		if (!stats->frames)
+			first = rec->timestamp;
+
+		if (speed > 0)
+		{
+			due = start + (UNS64)((rec->timestamp - first) / speed);
+			now = SDO_now();
+			if (now < due)
+			{
+				ts.tv_sec = due / 1000000000ull;
+				ts.tv_nsec = due % 1000000000ull;
+				while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) == EINTR)
+					continue;
+				now = SDO_now();
+			}
+			if (now > due && now - due > stats->maxLate)
+				stats->maxLate = now - due;
+		}
+
+		m.cob_id = rec->cob_id;
+		m.rtr = (rec->flags & TRACE_RTR) ? 1 : 0;
+		m.len = rec->len;
+		memcpy(m.data, rec->data, 8);
+		EnterMutex();
+		canDispatch(d, &m);
+		LeaveMutex();
+		stats->frames++;
+	}
+	stats->elapsed = SDO_now() - start;
+
+	munmap((void*)header, st.st_size);
+	return 0;
+}
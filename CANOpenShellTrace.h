@@ -0,0 +1,73 @@
+/*
+This file is part of CanFestival, a library implementing CanOpen Stack.
+
+Copyright (C): Edouard TISSERANT and Francis DUPIN
+
+See COPYING file for copyrights details.
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+
+#ifndef CANOPENSHELLTRACE_H
+#define CANOPENSHELLTRACE_H
+
+#include "canfestival.h"
+
+#define TRACE_MAGIC "COSTRACE"
+#define TRACE_VERSION 1
+
+#define TRACE_TX	0x01	/* frame sent by this node, otherwise received */
+#define TRACE_RTR	0x02
+
+/* File layout: one Trace_header followed by count fixed-size records */
+typedef struct {
+	char magic[8];
+	UNS32 version;
+	UNS32 recordSize;
+	UNS64 count;		/* records in the file, kept up to date */
+	UNS64 start;		/* CLOCK_REALTIME at start, ns, for display */
+} Trace_header;
+
+typedef struct {
+	UNS64 timestamp;	/* CLOCK_MONOTONIC, ns */
+	UNS16 cob_id;
+	UNS8 len;
+	UNS8 flags;
+	UNS8 nodeState;		/* NMT state of this node at that time */
+	UNS8 reserved[3];
+	UNS8 data[8];
+} Trace_record;
+
+/* Record every frame received and sent into an append-only memory mapped
+ * file. Trace_frame() is called with the stack mutex held, which also
+ * serialises the writers; the file only grows by whole chunks. */
+int Trace_start(const char* path);
+void Trace_stop(void);
+int Trace_running(void);
+UNS64 Trace_count(void);
+void Trace_frame(CO_Data* d, const Message* m, UNS64 timestamp, UNS8 flags);
+
+typedef struct {
+	UNS64 frames;		/* frames dispatched */
+	UNS64 elapsed;		/* ns */
+	UNS64 maxLate;		/* ns behind the recorded timing, worst frame */
+} Trace_replay_stats;
+
+/* Feed the received frames of a trace to canDispatch() as if they came
+ * from the bus. speed 1.0 replays in real time, 2.0 twice as fast, 0 as
+ * fast as possible. Must be called without the stack mutex held. */
+int Trace_replay(CO_Data* d, const char* path, double speed, Trace_replay_stats* stats);
+
+#endif // CANOPENSHELLTRACE_H